@@ -6,27 +6,45 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../Src/ILI_9341.c \
+../Src/blend.c \
+../Src/dirty.c \
+../Src/gfx.c \
 ../Src/gpio.c \
+../Src/lcd_par.c \
+../Src/lcd_queue.c \
 ../Src/main.c \
 ../Src/spi.c \
+../Src/strip.c \
 ../Src/syscalls.c \
 ../Src/sysmem.c \
 ../Src/uart.c 
 
 OBJS += \
 ./Src/ILI_9341.o \
+./Src/blend.o \
+./Src/dirty.o \
+./Src/gfx.o \
 ./Src/gpio.o \
+./Src/lcd_par.o \
+./Src/lcd_queue.o \
 ./Src/main.o \
 ./Src/spi.o \
+./Src/strip.o \
 ./Src/syscalls.o \
 ./Src/sysmem.o \
 ./Src/uart.o 
 
 C_DEPS += \
 ./Src/ILI_9341.d \
+./Src/blend.d \
+./Src/dirty.d \
+./Src/gfx.d \
 ./Src/gpio.d \
+./Src/lcd_par.d \
+./Src/lcd_queue.d \
 ./Src/main.d \
 ./Src/spi.d \
+./Src/strip.d \
 ./Src/syscalls.d \
 ./Src/sysmem.d \
 ./Src/uart.d 
@@ -39,7 +57,7 @@ Src/%.o Src/%.su Src/%.cyclo: ../Src/%.c Src/subdir.mk
 clean: clean-Src
 
 clean-Src:
-	-$(RM) ./Src/ILI_9341.cyclo ./Src/ILI_9341.d ./Src/ILI_9341.o ./Src/ILI_9341.su ./Src/gpio.cyclo ./Src/gpio.d ./Src/gpio.o ./Src/gpio.su ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/spi.cyclo ./Src/spi.d ./Src/spi.o ./Src/spi.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su ./Src/uart.cyclo ./Src/uart.d ./Src/uart.o ./Src/uart.su
+	-$(RM) ./Src/ILI_9341.cyclo ./Src/ILI_9341.d ./Src/ILI_9341.o ./Src/ILI_9341.su ./Src/blend.cyclo ./Src/blend.d ./Src/blend.o ./Src/blend.su ./Src/dirty.cyclo ./Src/dirty.d ./Src/dirty.o ./Src/dirty.su ./Src/gfx.cyclo ./Src/gfx.d ./Src/gfx.o ./Src/gfx.su ./Src/gpio.cyclo ./Src/gpio.d ./Src/gpio.o ./Src/gpio.su ./Src/lcd_par.cyclo ./Src/lcd_par.d ./Src/lcd_par.o ./Src/lcd_par.su ./Src/lcd_queue.cyclo ./Src/lcd_queue.d ./Src/lcd_queue.o ./Src/lcd_queue.su ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/spi.cyclo ./Src/spi.d ./Src/spi.o ./Src/spi.su ./Src/strip.cyclo ./Src/strip.d ./Src/strip.o ./Src/strip.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su ./Src/uart.cyclo ./Src/uart.d ./Src/uart.o ./Src/uart.su
 
 .PHONY: clean-Src
 
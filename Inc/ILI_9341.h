@@ -7,26 +7,68 @@
 #include <stdint.h>
 #include "stm32f103xb.h" // STM32F103 마이크로컨트롤러의 레지스터 정의 (CMSIS 핵심)
 #include "gpio.h" // STM32F103 마이크로컨트롤러의 레지스터 정의 (CMSIS 핵심)
+#include "lcd_bus.h"
 #include "pin_define.h"
+#include "display.h"
 // ====================================================================
 // ==== ILI9341 LCD 드라이버 통합 시작 ==================================
 // ====================================================================
-// ILI9341 LCD 해상도 및 컬러 정의
+// ILI9341 LCD 해상도 및 컬러 정의 (패널 기본 세로 방향 기준, 회전 후 크기는 ILI9341_GetWidth/GetHeight)
 #define ILI9341_WIDTH  240
 #define ILI9341_HEIGHT 320
 
+// 핑퐁 라인 버퍼 크기 (버퍼 하나당 픽셀 수). RAM 사용량 = 2 x 2바이트 x ILI9341_LINEBUF_PIXELS
+// 기본 320 픽셀 -> 1.25KB (STM32F103RB RAM 20KB). 글자 렌더링이 한 줄씩 채우므로 화면 가로 픽셀 수 이상이어야 함.
+#ifndef ILI9341_LINEBUF_PIXELS
+#define ILI9341_LINEBUF_PIXELS 320
+#endif
+
+// 이 픽셀 수 이하의 스트림 전송은 DMA 대신 CPU로 보냄 (DMA 설정 + 완료 인터럽트 비용 회피)
+#ifndef ILI9341_STREAM_CPU_MAX
+#define ILI9341_STREAM_CPU_MAX 8
+#endif
+
+// GRAM 읽기(ILI9341_ReadPixels)에서 버스 읽기 한 번에 가져오는 픽셀 수. 스택 사용량 = 3바이트 x 이 값
+#ifndef ILI9341_READ_CHUNK
+#define ILI9341_READ_CHUNK 32
+#endif
+
+// V-blank 동기 채우기(ILI9341_FillRectSync)가 찢어짐 없이 끝낼 수 있는 최대 픽셀 수.
+// V-blank는 약 4줄(70Hz에서 ~0.18ms)뿐이라 16MHz SPI로는 ~180픽셀만 스캔이 돌아오기 전에 보낼 수 있다.
+// 전체 화면(76,800픽셀, ~77ms)은 한 프레임(~14ms)보다 훨씬 길어 어떤 방법으로도 한 번에 찢어짐 없이 쓸 수 없음.
+#ifndef ILI9341_SYNC_MAX_PIXELS
+#define ILI9341_SYNC_MAX_PIXELS 160
+#endif
+
+// TE 펄스를 기다리는 최대 시간 (ms). 70Hz 기준 약 두 프레임. TE 배선이 없는 보드에서 무한 대기 방지.
+#ifndef ILI9341_TE_TIMEOUT_MS
+#define ILI9341_TE_TIMEOUT_MS 30
+#endif
+
 // ILI9341 명령 (자주 사용되는 것들)
 #define ILI9341_NOP         0x00 // No Operation
 #define ILI9341_SWRESET     0x01 // Software Reset
 #define ILI9341_RDID4       0xD3 // Read ID4
+#define ILI9341_SLPIN       0x10 // Enter Sleep Mode
 #define ILI9341_SLPOUT      0x11 // Sleep Out
+#define ILI9341_PTLON       0x12 // Partial Mode ON
+#define ILI9341_NORON       0x13 // Normal Display Mode ON
 #define ILI9341_DISPOFF     0x28 // Display Off
 #define ILI9341_DISPON      0x29 // Display On
 #define ILI9341_CASET       0x2A // Column Address Set
 #define ILI9341_PASET       0x2B // Page Address Set
 #define ILI9341_RAMWR       0x2C // Memory Write
+#define ILI9341_RAMRD       0x2E // Memory Read
+#define ILI9341_PTLAR       0x30 // Partial Area
+#define ILI9341_VSCRDEF     0x33 // Vertical Scrolling Definition
+#define ILI9341_TEOFF       0x34 // Tearing Effect Line OFF
+#define ILI9341_TEON        0x35 // Tearing Effect Line ON
 #define ILI9341_MADCTL      0x36 // Memory Access Control
+#define ILI9341_VSCRSADD    0x37 // Vertical Scrolling Start Address
+#define ILI9341_IDMOFF      0x38 // Idle Mode OFF
+#define ILI9341_IDMON       0x39 // Idle Mode ON (8색)
 #define ILI9341_PIXFMT      0x3A // Pixel Format Set
+#define ILI9341_RAMWRC      0x3C // Memory Write Continue
 #define ILI9341_FRMCTR1     0xB1 // Frame Rate Control (In Normal Mode/Full Colors)
 #define ILI9341_DFUNCTR     0xB6 // Display Function Control
 #define ILI9341_PWCTR1      0xC0 // Power Control 1
@@ -36,6 +78,14 @@
 #define ILI9341_GMCTRN1     0xE1 // Negative Gamma Correction
 #define ILI9341_CMD_SET_ADDR_MODE 0x36
 
+// MADCTL 비트
+#define ILI9341_MADCTL_MY   0x80 // Row Address Order
+#define ILI9341_MADCTL_MX   0x40 // Column Address Order
+#define ILI9341_MADCTL_MV   0x20 // Row/Column Exchange
+#define ILI9341_MADCTL_ML   0x10 // Vertical Refresh Order
+#define ILI9341_MADCTL_BGR  0x08 // BGR 순서
+#define ILI9341_MADCTL_MH   0x04 // Horizontal Refresh Order
+
 // 컬러 정의 (16비트 RGB565 포맷)
 #define COLOR_BLACK       0x0000
 #define COLOR_NAVY        0x000F
@@ -59,6 +109,10 @@
 
 
 
+// main.c의 SysTick 기반 시간 함수/변수
+void delay_ms(uint32_t ms);
+extern volatile uint32_t ms_uptime;
+
 // ILI9341 함수 프로토타입
 void ILI9341_init_pins(void);
 void ILI9341_CS_Enable(void);
@@ -72,11 +126,44 @@ void ILI9341_BL_Off(void);
 
 void ILI9341_WriteCommand(uint8_t cmd);
 void ILI9341_WriteData(uint8_t data);
+void ILI9341_WriteCommandData(uint8_t cmd, const uint8_t *params, uint8_t len);
 void ILI9341_init(void);
+uint32_t ILI9341_GetInitTime(void);
+void ILI9341_SetRotation(uint8_t rotation);
+uint8_t ILI9341_GetRotation(void);
+uint16_t ILI9341_GetWidth(void);
+uint16_t ILI9341_GetHeight(void);
 void ILI9341_SetAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
-void ILI9341_FillScreen(uint16_t color);
-void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color);
-void ILI9341_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
-void ILI9341_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char *image_data) ;
+void ILI9341_BeginWrite(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void ILI9341_AdvanceWrite(uint32_t count);
+void ILI9341_EndWrite(void);
+void ILI9341_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ILI9341_StreamBegin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+uint32_t ILI9341_GetSkippedSetupBytes(void);
+uint16_t *ILI9341_StreamBuffer(void);
+void ILI9341_StreamSubmit(uint16_t count);
+void ILI9341_StreamWrite(const uint16_t *pixels, uint32_t count);
+void ILI9341_StreamEnd(void);
+void ILI9341_ReadPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *buf);
+uint16_t ILI9341_ReadPixel(uint16_t x, uint16_t y);
+void ILI9341_SetScrollArea(uint16_t top_fixed, uint16_t bottom_fixed);
+void ILI9341_ScrollTo(uint16_t offset);
+uint16_t ILI9341_GetScrollOffset(void);
+uint16_t ILI9341_ScrollMapRow(uint16_t y);
+void ILI9341_ScrollAdvance(uint16_t lines, uint16_t bg_color);
+void ILI9341_TE_init(void);
+void ILI9341_TE_SimulatePulse(void);
+uint32_t ILI9341_TE_GetFrameCount(void);
+uint8_t ILI9341_WaitForVBlank(void);
+uint8_t ILI9341_FillRectSync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+void ILI9341_SetPartialArea(uint16_t start_row, uint16_t end_row);
+void ILI9341_NormalMode(void);
+void ILI9341_IdleMode(uint8_t on);
+void ILI9341_Sleep(uint8_t on);
+uint8_t ILI9341_IsBusy(void);
+void ILI9341_WaitDone(void);
+
+// 그래픽 계층(gfx.c)에 넘길 ILI9341 백엔드
+extern const display_driver_t ili9341_driver;
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,51 @@
+/*
+ * blend.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef BLEND_H_
+#define BLEND_H_
+
+#include <stdint.h>
+
+// ====================================================================
+// ==== RGB565 알파 블렌딩 커널 =======================================
+// ====================================================================
+// green-split: 0bRRRRRGGGGGGBBBBB를 32비트로 펼쳐 G를 상위 하프워드(비트 21~26), R/B를 하위(비트 11~15, 0~4)에 둔다.
+//   0x07E0F81F 마스크 뒤 각 채널 위에 5비트 이상 빈 자리가 생기므로, 5비트 알파(0~32) 곱셈 한 번으로
+//   세 채널을 동시에 블렌딩해도 채널끼리 넘치지 않는다 (Cortex-M3 MUL 1사이클).
+// 모든 커널은 라인 버퍼(dst)를 제자리에서 갱신하므로 결과를 그대로 픽셀 스트림에 넘기면 된다.
+#define BLEND_SPLIT_MASK 0x07E0F81FUL
+
+// 8비트 알파(0~255) -> 5비트 블렌드 계수(0~32)
+#define BLEND_A8_TO_A5(a) (((uint32_t)(a) + 4) >> 3)
+
+static inline uint32_t Blend_Expand(uint16_t c) {
+    return ((uint32_t)c | ((uint32_t)c << 16)) & BLEND_SPLIT_MASK;
+}
+
+static inline uint16_t Blend_Pack(uint32_t x) {
+    x &= BLEND_SPLIT_MASK;
+    return (uint16_t)(x | (x >> 16));
+}
+
+/**
+  * @brief  픽셀 하나 블렌딩: fg * a5/32 + bg * (32 - a5)/32
+  * @param  a5: 0 (bg) ~ 32 (fg)
+  */
+static inline uint16_t Blend_Pixel(uint16_t fg, uint16_t bg, uint32_t a5) {
+    uint32_t b = Blend_Expand(bg);
+    return Blend_Pack((((Blend_Expand(fg) - b) * a5) >> 5) + b);
+}
+
+// 블렌딩 커널 프로토타입 선언 (dst: 라인 버퍼, n: 픽셀 수)
+void Blend_Alpha8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t n);
+void Blend_Const(uint16_t *dst, const uint16_t *src, uint8_t alpha, uint32_t n);
+void Blend_Fill(uint16_t *dst, uint16_t color, uint8_t alpha, uint32_t n);
+void Blend_Premul(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t n);
+void Blend_MaskA8(uint16_t *dst, uint16_t color, const uint8_t *mask, uint32_t n);
+void Blend_MaskA4(uint16_t *dst, uint16_t color, const uint8_t *mask, uint32_t first, uint32_t n);
+
+#endif /* BLEND_H_ */
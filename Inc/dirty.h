@@ -0,0 +1,60 @@
+/*
+ * dirty.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef DIRTY_H_
+#define DIRTY_H_
+
+#include <stdint.h>
+
+// ====================================================================
+// ==== 변경 영역(damage) 추적 ========================================
+// ====================================================================
+// 한 프레임 동안 바뀐 사각형을 모아 두었다가, 다시 그릴 창 목록으로 돌려준다.
+// 사각형을 넣을 때마다 비용 모델로 합칠지 결정한다:
+//   따로 그리면 면적 A + B + 창 2개, 합치면 외곽 사각형 면적 + 창 1개
+//   -> 외곽 면적 <= A + B + window_cost 이면 합침 (겹치는 부분은 따로 그릴 때 두 번 그려지는 것으로 계산)
+// window_cost는 창 하나를 잡는 고정 비용(CASET/PASET/RAMWR 11바이트, CS/DC 전환, DMA 설정)을 픽셀 수로 환산한 값.
+// 좌표는 화면 좌표이며 Dirty_Init에 준 화면 크기로 잘린다.
+// 주의: main 문맥에서만 호출할 것.
+
+// 한 프레임에 들고 있을 수 있는 사각형 수 (넘치면 가장 싸게 합쳐지는 쌍을 합침)
+#ifndef DIRTY_MAX_RECTS
+#define DIRTY_MAX_RECTS 16
+#endif
+
+// 창 하나의 기본 고정 비용 (픽셀 환산)
+#ifndef DIRTY_WINDOW_COST
+#define DIRTY_WINDOW_COST 32
+#endif
+
+typedef struct {
+    int16_t x, y;
+    int16_t w, h;
+} dirty_rect_t;
+
+// 프레임 통계 (Dirty_Take 때 갱신)
+typedef struct {
+    uint32_t frames;          // Dirty_Take 횟수
+    uint16_t last_adds;       // 직전 프레임에 들어온 사각형 수 (잘려서 버려진 것 제외)
+    uint8_t  last_windows;    // 직전 프레임에 돌려준 창 수
+    uint32_t last_pixels;     // 직전 프레임에 다시 그릴 픽셀 수 (창 면적 합)
+    uint32_t screen_pixels;   // 화면 전체 픽셀 수 (비교 기준)
+    uint32_t total_pixels;    // 누적 다시 그린 픽셀 수
+    uint32_t total_windows;   // 누적 창 수
+} dirty_stats_t;
+
+// 변경 영역 추적 함수 프로토타입 선언
+void Dirty_Init(uint16_t width, uint16_t height);
+void Dirty_SetWindowCost(uint32_t cost);
+void Dirty_Add(int16_t x, int16_t y, int16_t w, int16_t h);
+void Dirty_AddAll(void);
+uint8_t Dirty_IsEmpty(void);
+uint8_t Dirty_Take(dirty_rect_t *out);
+void Dirty_GetStats(dirty_stats_t *stats);
+void Dirty_ResetStats(void);
+
+#endif /* DIRTY_H_ */
@@ -0,0 +1,50 @@
+/*
+ * display.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+#include <stdint.h>
+
+// ====================================================================
+// ==== 디스플레이 드라이버 인터페이스 =================================
+// ====================================================================
+// 그래픽/텍스트 코드(gfx.c)는 이 인터페이스만 사용하고, 패널별 명령/초기화/버스 처리는 백엔드가 담당한다.
+// 픽셀은 항상 RGB565로 넘기며, 다른 픽셀 포맷이 필요한 패널(예: ILI9488의 SPI 18비트 전용 모드)은
+// stream_submit/fill_rect 안에서 변환한다. 함수 포인터 호출은 프리미티브(또는 라인 버퍼)당 한 번이므로
+// 픽셀 단위 오버헤드는 없다.
+typedef struct {
+    const char *name;             // 패널 이름 (디버그 출력용)
+    uint16_t linebuf_pixels;      // stream_buffer()가 돌려주는 버퍼의 픽셀 수
+
+    void     (*init)(void);                         // 리셋 + 초기화 시퀀스
+    uint16_t (*width)(void);                        // 현재 회전 기준 가로 픽셀 수
+    uint16_t (*height)(void);                       // 현재 회전 기준 세로 픽셀 수
+    void     (*set_rotation)(uint8_t rotation);     // 0 ~ 3 (90도 단위)
+
+    // 단색 직사각형 (클리핑은 호출자가 끝낸 상태). 비동기(DMA)로 처리될 수 있다.
+    void     (*fill_rect)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+
+    // 픽셀 스트림: begin(창 설정) -> buffer 채우기 -> submit 반복 -> end
+    void     (*stream_begin)(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+    uint16_t *(*stream_buffer)(void);
+    void     (*stream_submit)(uint16_t count);
+    void     (*stream_write)(const uint16_t *pixels, uint32_t count); // 호출자 버퍼를 복사 없이 전송
+    void     (*stream_end)(void);
+
+    // GRAM 읽기 (지원하지 않는 패널은 NULL)
+    void     (*read_pixels)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *buf);
+
+    // 하드웨어 세로 스크롤
+    void     (*set_scroll_area)(uint16_t top_fixed, uint16_t bottom_fixed);
+    void     (*scroll_to)(uint16_t offset);
+
+    // 진행 중인 비동기 전송 완료 대기
+    void     (*wait_idle)(void);
+} display_driver_t;
+
+#endif /* DISPLAY_H_ */
@@ -0,0 +1,103 @@
+/*
+ * gfx.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef GFX_H_
+#define GFX_H_
+
+#include <stdint.h>
+#include "display.h"
+
+// ====================================================================
+// ==== 패널 독립 그래픽 계층 =========================================
+// ====================================================================
+// 모든 프리미티브는 GFX_init()에 넘긴 display_driver_t만 사용한다.
+// 좌표/크기는 현재 회전 방향 기준 논리 좌표이며, 클리핑은 이 계층에서 끝낸 뒤 드라이버에 넘긴다.
+// GFX_PushViewport / GFX_PushClip 중에는 좌표가 뷰포트 기준 로컬 좌표가 되고 클립 영역 밖은 그리지 않는다.
+
+// 클립/뷰포트 스택 깊이 (중첩 위젯 단계 수)
+#define GFX_CLIP_DEPTH 8
+
+// 5x5 폰트 정보
+#define FONT_CHAR_WIDTH  5 // 폰트 자체의 가로 픽셀 수 (주석 상 5)
+#define FONT_CHAR_HEIGHT 5 // 폰트 자체의 세로 픽셀 수 (주석 상 5)
+#define FONT_COL_BYTES   6 // 폰트 데이터에서 한 문자가 차지하는 바이트 수
+
+// 안티앨리어싱 램프 단계 수 (배경색 ~ 전경색)
+#define GFX_AA_LEVELS 16
+
+// GFX_BlendRect가 GRAM을 한 번에 읽어 블렌딩하는 픽셀 수 (스택 버퍼 크기)
+#define GFX_BLEND_CHUNK 64
+
+// GFX_FillGradient / GFX_FillRadial flags
+#define GFX_GRAD_H        0x00   // 왼쪽 c0 -> 오른쪽 c1
+#define GFX_GRAD_V        0x01   // 위 c0 -> 아래 c1
+#define GFX_GRAD_DIAG     0x02   // 왼쪽 위 c0 -> 오른쪽 아래 c1
+#define GFX_GRAD_DIR_MASK 0x03
+#define GFX_GRAD_DITHER   0x80   // 8x8 Bayer 순서 디더링 (RGB565 계단 완화)
+
+// 다각형 꼭짓점의 서브픽셀 정밀도 (1/16 픽셀)
+#define GFX_SUBPIXEL_BITS 4
+#define GFX_SUBPIXEL      (1 << GFX_SUBPIXEL_BITS)
+// 정수 픽셀 좌표 -> 서브픽셀 좌표 (픽셀 중심)
+#define GFX_FX(px)        ((int16_t)((px) * GFX_SUBPIXEL + GFX_SUBPIXEL / 2))
+
+// 서브픽셀 좌표 꼭짓점
+typedef struct {
+    int16_t x, y;
+} gfx_point_t;
+
+// 그래픽 함수 프로토타입 선언
+void GFX_init(const display_driver_t *drv);
+const display_driver_t *GFX_GetDriver(void);
+void GFX_SetDriver(const display_driver_t *drv);
+void GFX_SetRotation(uint8_t rotation);
+uint16_t GFX_GetWidth(void);
+uint16_t GFX_GetHeight(void);
+void GFX_WaitDone(void);
+void GFX_ResetClip(void);
+uint8_t GFX_PushViewport(int16_t x, int16_t y, int16_t w, int16_t h);
+uint8_t GFX_PushClip(int16_t x, int16_t y, int16_t w, int16_t h);
+void GFX_PopClip(void);
+uint8_t GFX_IsVisible(int16_t x, int16_t y, int16_t w, int16_t h);
+void GFX_FillScreen(uint16_t color);
+void GFX_DrawPixel(int16_t x, int16_t y, uint16_t color);
+void GFX_DrawRectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+void GFX_DrawImage(int16_t x, int16_t y, uint16_t w, uint16_t h, const char *image_data);
+void GFX_DrawImage16(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *image_data);
+void GFX_DrawSpan(int16_t x, int16_t y, int16_t len, uint16_t color);
+void GFX_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+void GFX_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+void GFX_DrawFrame(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void GFX_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+int16_t GFX_Sin(int16_t deg);
+int16_t GFX_Cos(int16_t deg);
+void GFX_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+void GFX_FillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color);
+void GFX_DrawEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color);
+void GFX_FillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color);
+void GFX_DrawArc(int16_t cx, int16_t cy, int16_t r, int16_t start_deg, int16_t end_deg, uint16_t color);
+void GFX_FillArc(int16_t cx, int16_t cy, int16_t r_outer, int16_t r_inner,
+                 int16_t start_deg, int16_t end_deg, uint16_t color);
+void GFX_FillPolygonFx(const gfx_point_t *pts, uint8_t n, uint16_t color);
+void GFX_FillTriangleFx(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+void GFX_FillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+void GFX_DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+void GFX_DrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t fg, uint16_t bg);
+void GFX_DrawCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t fg, uint16_t bg);
+void GFX_FillCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t fg, uint16_t bg);
+void GFX_DrawMask(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *mask, uint8_t bits,
+                  uint16_t fg, uint16_t bg);
+void GFX_BlendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha);
+void GFX_FillGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c0, uint16_t c1, uint8_t flags);
+void GFX_FillRadial(int16_t x, int16_t y, int16_t w, int16_t h, int16_t cx, int16_t cy, int16_t r,
+                    uint16_t c0, uint16_t c1, uint8_t flags);
+void GFX_FillPattern(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *pattern, uint16_t fg, uint16_t bg);
+void GFX_FillDither(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint8_t g, uint8_t b);
+void GFX_DrawChar(char c, int16_t x, int16_t y, uint16_t color, uint16_t bg_color, uint8_t scale);
+void GFX_DrawString(const char *str, int16_t x, int16_t y, uint16_t color, uint16_t bg_color, uint8_t scale);
+
+#endif /* GFX_H_ */
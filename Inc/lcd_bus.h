@@ -0,0 +1,64 @@
+/*
+ * lcd_bus.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef LCD_BUS_H_
+#define LCD_BUS_H_
+
+// ====================================================================
+// ==== LCD 버스 선택 (빌드 시점) =====================================
+// ====================================================================
+// ILI_9341.c와 lcd_queue.c는 버스에 직접 접근하지 않고 아래 LCD_BUS_* 매크로만 사용한다.
+// 매크로가 SPI1_* 또는 LCD_PAR_* 함수로 바로 치환되므로 런타임 분기/간접 호출 비용은 없다.
+//   LCD_BUS_SPI  : SPI1 + DMA (기본값, 비동기 전송)
+//   LCD_BUS_PAR8 : 8080 8비트 병렬 버스 (CPU 전송, 완료 콜백은 즉시 호출됨)
+// 예: 컴파일 옵션에 -DLCD_BUS=LCD_BUS_PAR8
+#define LCD_BUS_SPI   0
+#define LCD_BUS_PAR8  1
+
+#ifndef LCD_BUS
+#define LCD_BUS LCD_BUS_SPI
+#endif
+
+#if LCD_BUS == LCD_BUS_PAR8
+
+#include "lcd_par.h"
+
+#define LCD_BUS_init()                      LCD_PAR_init()
+#define LCD_BUS_write(data, len)            LCD_PAR_write((data), (len))
+#define LCD_BUS_pixel_mode()                ((void)0)   // 픽셀은 항상 상위/하위 바이트 순서로 전송
+#define LCD_BUS_byte_mode()                 ((void)0)
+#define LCD_BUS_write16(data, count)        LCD_PAR_write16((data), (count))
+#define LCD_BUS_write16_async(data, count, done) LCD_PAR_write16_async((data), (count), (done))
+#define LCD_BUS_fill16(value, count, done)  LCD_PAR_fill16((value), (count), (done))
+#define LCD_BUS_busy()                      0
+#define LCD_BUS_wait()                      ((void)0)
+#define LCD_BUS_read_begin()                LCD_PAR_read_begin()
+#define LCD_BUS_read(data, len)             LCD_PAR_read((data), (len))
+#define LCD_BUS_read_end()                  LCD_PAR_read_end()
+
+#elif LCD_BUS == LCD_BUS_SPI
+
+#include "spi.h"
+
+#define LCD_BUS_init()                      SPI1_init()
+#define LCD_BUS_write(data, len)            SPI1_write((data), (len))
+#define LCD_BUS_pixel_mode()                SPI1_set_16bit_mode()   // 픽셀 1개 = 16비트 프레임 1개
+#define LCD_BUS_byte_mode()                 SPI1_set_8bit_mode()
+#define LCD_BUS_write16(data, count)        SPI1_write16((data), (count))
+#define LCD_BUS_write16_async(data, count, done) SPI1_DMA_write16((data), (count), (done))
+#define LCD_BUS_fill16(value, count, done)  SPI1_DMA_fill16((value), (count), (done))
+#define LCD_BUS_busy()                      SPI1_DMA_busy()
+#define LCD_BUS_wait()                      SPI1_DMA_wait()
+#define LCD_BUS_read_begin()                SPI1_set_baudrate(SPI1_READ_PRESCALER)  // 읽기 사이클은 느리게
+#define LCD_BUS_read(data, len)             SPI1_read((data), (len))
+#define LCD_BUS_read_end()                  SPI1_set_baudrate(SPI1_BAUDRATE_PRESCALER)
+
+#else
+#error "LCD_BUS must be LCD_BUS_SPI or LCD_BUS_PAR8"
+#endif
+
+#endif /* LCD_BUS_H_ */
@@ -0,0 +1,46 @@
+/*
+ * lcd_par.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef LCD_PAR_H_
+#define LCD_PAR_H_
+
+#include "gpio.h"
+#include "pin_define.h"
+
+// ====================================================================
+// ==== 8080 8비트 병렬 버스 (ILI9341 IM[3:0] = 0011, 8080-I 8비트) ====
+// ====================================================================
+// D0~D7 = PB8~PB15, WRX = PB5, RDX = PB6 (CS/DC/RST는 SPI 배선과 같은 핀 사용)
+// 한 바이트 = BSRR 쓰기 2번: (데이터 8비트 + WR LOW)를 한 번에 쓰고, WR HIGH 상승 에지에서 패널이 래치.
+// SPI처럼 DMA가 없으므로 모든 전송은 CPU가 끝낸 뒤 돌아오고, 완료 콜백은 그 자리에서 호출된다.
+
+// GPIO 레지스터 쓰기 훅. 호스트 빌드에서 이 매크로를 기록 함수로 바꾸면
+// (레지스터, 값) 순서열을 얻을 수 있다. 디코딩 규칙:
+//   - BSRR 쓰기 중 상위 16비트에 LCD_PAR_WR_PIN이 있으면 한 바이트 = (값 >> LCD_PAR_DATA_SHIFT) & 0xFF
+//   - BRR에 LCD_PAR_WR_PIN만 쓰면 직전 바이트를 한 번 더 보냄 (LCD_PAR_fill16의 같은 바이트 반복)
+//   - DC 핀(ILI9341_DC_PIN)의 BSRR/BRR 쓰기로 명령(LOW)/데이터(HIGH) 구분
+// 예: #define LCD_PAR_GPIO_WRITE(reg, val) host_gpio_record(&(reg), (val))
+#ifndef LCD_PAR_GPIO_WRITE
+#define LCD_PAR_GPIO_WRITE(reg, val) ((reg) = (val))
+#endif
+
+// 읽기 사이클에서 RD LOW 유지 루프 횟수 (GRAM 읽기 tRDLFM 355ns 이상, 64MHz 기준)
+#ifndef LCD_PAR_RD_DELAY
+#define LCD_PAR_RD_DELAY 8
+#endif
+
+// 병렬 버스 함수 프로토타입 선언
+void LCD_PAR_init(void);
+void LCD_PAR_write(const uint8_t *data, uint32_t len);
+void LCD_PAR_write16(const uint16_t *data, uint32_t count);
+void LCD_PAR_write16_async(const uint16_t *data, uint32_t count, void (*done)(void));
+void LCD_PAR_fill16(uint16_t value, uint32_t count, void (*done)(void));
+void LCD_PAR_read_begin(void);
+void LCD_PAR_read(uint8_t *data, uint32_t len);
+void LCD_PAR_read_end(void);
+
+#endif /* LCD_PAR_H_ */
@@ -0,0 +1,49 @@
+/*
+ * lcd_queue.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef LCD_QUEUE_H_
+#define LCD_QUEUE_H_
+
+#include <stdint.h>
+#include "ILI_9341.h"
+
+// ====================================================================
+// ==== 비동기 디스플레이 명령 큐 =====================================
+// ====================================================================
+// 그리기 명령을 고정 크기 링 버퍼에 쌓고, SPI1 DMA 완료 인터럽트가 하나씩 꺼내 실행한다.
+// main 루프는 한 프레임 분량의 명령을 넣은 뒤 바로 UART/센서 작업으로 돌아갈 수 있다.
+// 주의: 큐에 넣는 함수들은 main 문맥에서만 호출할 것 (단일 생산자).
+
+// 큐 깊이 (명령 개수)
+#ifndef LCD_QUEUE_DEPTH
+#define LCD_QUEUE_DEPTH 16
+#endif
+
+// 명령 완료 콜백 (DMA 인터럽트 문맥에서 호출되므로 짧게 작성할 것)
+typedef void (*lcd_queue_cb_t)(void *arg);
+
+// 큐 튜닝용 통계
+typedef struct {
+    uint8_t  depth;       // 큐 깊이 (LCD_QUEUE_DEPTH)
+    uint8_t  pending;     // 현재 대기 중인 명령 수 (실행 중인 것 포함)
+    uint8_t  high_water;  // 지금까지 가장 많이 쌓였던 명령 수
+    uint32_t stalls;      // 큐가 가득 차서 넣는 쪽이 기다린 횟수
+    uint32_t completed;   // 완료된 명령 수
+} lcd_queue_stats_t;
+
+// 큐 함수 프로토타입 선언
+void LCD_Queue_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color,
+                        lcd_queue_cb_t done, void *arg);
+void LCD_Queue_Image16(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *image_data,
+                       lcd_queue_cb_t done, void *arg);
+void LCD_Queue_Marker(lcd_queue_cb_t done, void *arg);
+uint8_t LCD_Queue_IsIdle(void);
+void LCD_Queue_Flush(void);
+void LCD_Queue_GetStats(lcd_queue_stats_t *stats);
+void LCD_Queue_ResetStats(void);
+
+#endif /* LCD_QUEUE_H_ */
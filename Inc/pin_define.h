@@ -9,6 +9,8 @@
 #define ILI9341_RST_PORT  GPIOB
 #define ILI9341_RST_PIN   GPIO_PIN_0  // PB0
 #define ILI9341_BL_PIN    GPIO_PIN_2  // PB2 (백라이트)
+#define ILI9341_TE_PORT   GPIOA
+#define ILI9341_TE_PIN    GPIO_PIN_8  // PA8 (Tearing Effect 출력 -> EXTI8)
 
 
 // SPI PIN Define
@@ -17,4 +19,11 @@
 #define MISO_PIN GPIO_PIN_6 // Master In Slave Out (PA6)
 #define MOSI_PIN GPIO_PIN_7 // Master Out Slave In (PA7)
 
+// 8080 8비트 병렬 버스 (LCD_BUS == LCD_BUS_PAR8일 때만 사용, CS/DC/RST는 위와 동일)
+#define LCD_PAR_PORT       GPIOB
+#define LCD_PAR_DATA_SHIFT 8            // D0~D7 = PB8~PB15
+#define LCD_PAR_DATA_MASK  0xFF00       // PB8~PB15
+#define LCD_PAR_WR_PIN     GPIO_PIN_5   // PB5 (WRX)
+#define LCD_PAR_RD_PIN     GPIO_PIN_6   // PB6 (RDX)
+
 #endif
\ No newline at end of file
@@ -19,10 +19,44 @@
 // SPI1의 MISO (PA6) 핀은 루프백 테스트와 ID 읽기 등에서 필요하다.
 
 // SPI1 RX 인터럽트 발생 횟수를 저장할 전역 변수 (SPI 디버깅용)
+extern volatile uint32_t spi1_rx_irq_count;   // 실제 RX ISR 진입 횟수
+extern volatile uint32_t spi1_rx_irq_avoided; // 송신 전용 모드로 피한 RX ISR 진입 횟수
+
+// SPI1 보드레이트 프리스케일러 (CR1 BR[2:0], PCLK2 = 64MHz)
+// 0: PCLK2/2 (32MHz), 1: PCLK2/4 (16MHz), 2: PCLK2/8 (8MHz) ...
+// 버스트 쓰기 API가 CS/DC 변경 전에 BSY를 기다리므로 0(PCLK2/2)으로 올려도 명령 바이트가 깨지지 않는다.
+#ifndef SPI1_BAUDRATE_PRESCALER
+#define SPI1_BAUDRATE_PRESCALER 1
+#endif
+
+// LCD 읽기(RAMRD 등)용 프리스케일러. ILI9341 읽기 사이클은 최소 150ns이므로 PCLK2/16 (4MHz)
+#ifndef SPI1_READ_PRESCALER
+#define SPI1_READ_PRESCALER 3
+#endif
 
 // SPI 함수 프로토타입 선언
 void SPI1_init(void);
 uint8_t SPI1_transfer(uint8_t data);
+void SPI1_wait_idle(void);
+void SPI1_write(const uint8_t *data, uint32_t len);
+
+// 16비트 프레임 모드 (RGB565 픽셀 스트림용)
+void SPI1_set_16bit_mode(void);
+void SPI1_set_8bit_mode(void);
+void SPI1_transfer16(uint16_t data);
+void SPI1_write16(const uint16_t *data, uint32_t count);
+
+// 송신 전용 / 읽기 트랜잭션 제어 (RX 인터럽트는 항상 꺼져 있고 읽기는 폴링)
+void SPI1_rx_flush(void);
+void SPI1_set_baudrate(uint8_t prescaler);
+void SPI1_read(uint8_t *data, uint32_t len);
+
+// SPI1 TX DMA (DMA1 Channel 3) 함수 프로토타입 선언
+void SPI1_DMA_init(void);
+void SPI1_DMA_fill16(uint16_t value, uint32_t count, void (*done)(void));
+void SPI1_DMA_write16(const uint16_t *data, uint32_t count, void (*done)(void));
+uint8_t SPI1_DMA_busy(void);
+void SPI1_DMA_wait(void);
 
 
 #endif /* SPI_H_ */
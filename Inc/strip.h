@@ -0,0 +1,42 @@
+/*
+ * strip.h
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#ifndef STRIP_H_
+#define STRIP_H_
+
+#include <stdint.h>
+#include "display.h"
+
+// ====================================================================
+// ==== 스트립(띠) 프레임버퍼 렌더러 ===================================
+// ====================================================================
+// 전체 프레임버퍼(240x320 RGB565 = 150KB)는 RAM(20KB)에 들어가지 않으므로, 영역을 가로 띠로 나눠
+// 띠마다 그리기 콜백을 다시 호출해 RAM 띠에 합성한 뒤 패널로 보낸다.
+//   - 그리기 중에는 GFX 드라이버가 RAM 띠 드라이버로 바뀌고, 클립 영역이 호출자의 현재 클립과 띠의 교차로 좁혀지므로
+//     띠 밖의 프리미티브는 래스터화 전에 버려진다 (클립 스택은 호출 전 상태로 복귀).
+//   - 띠 버퍼는 두 개(핑퐁): 띠 k를 DMA로 보내는 동안 CPU가 띠 k+1을 그린다.
+//   - 패널 창은 영역 전체에 한 번만 잡고 띠를 이어서 스트림한다 -> 픽셀당 버스 쓰기 1번, 깜빡임/덧그리기 없음.
+// 콜백 안에서는 GFX_* 함수만 사용할 것 (패널 스트림이 열려 있으므로 LCD_Queue/ILI9341_* 직접 호출 금지).
+
+// 띠 버퍼 전체 픽셀 수 (핑퐁 두 개로 나눠 씀). RAM 사용량 = 2바이트 x STRIP_BUFFER_PIXELS
+// 기본값 240 x 16: 세로 모드 전체 폭에서 띠 하나가 8줄 (가로 모드 320폭이면 6줄)
+#ifndef STRIP_BUFFER_PIXELS
+#define STRIP_BUFFER_PIXELS (240 * 16)
+#endif
+
+// GFX가 stream_buffer()로 받는 임시 줄 버퍼 크기 (화면 가로보다 작으면 안 됨: GFX_DrawChar가 한 줄씩 채움)
+#ifndef STRIP_LINEBUF_PIXELS
+#define STRIP_LINEBUF_PIXELS 320
+#endif
+
+// 그리기 콜백: 화면 좌표로 장면 전체를 그린다 (띠마다 한 번씩 호출됨)
+typedef void (*strip_draw_t)(void *arg);
+
+// 스트립 렌더러 함수 프로토타입 선언
+uint16_t Strip_Render(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg, strip_draw_t draw, void *arg);
+
+#endif /* STRIP_H_ */
@@ -1,4 +1,31 @@
 #include "ILI_9341.h"
+
+// 제어 핀 쓰기. 병렬 버스에서는 기록 훅을 거치게 해서 호스트에서 명령/데이터 구분까지 디코딩할 수 있게 한다.
+#if LCD_BUS == LCD_BUS_PAR8
+#define ILI9341_PIN_WRITE(port, pin, state) \
+    LCD_PAR_GPIO_WRITE(*((state) ? &(port)->BSRR : &(port)->BRR), (pin))
+#else
+#define ILI9341_PIN_WRITE(port, pin, state) GPIO_WritePin((port), (pin), (state))
+#endif
+
+// 현재 회전 방향 기준의 논리 화면 크기 (모든 그리기 함수가 이 크기로 클리핑)
+static uint16_t ili9341_width = ILI9341_WIDTH;
+static uint16_t ili9341_height = ILI9341_HEIGHT;
+static uint8_t  ili9341_rotation = 0;
+
+// 주소 창 캐시: 패널에 마지막으로 보낸 CASET/PASET 값
+static struct {
+    uint16_t x1, x2, y1, y2;
+    uint8_t  col_valid;      // 1: x1/x2가 패널 값과 같음
+    uint8_t  row_valid;      // 1: y1/y2가 패널 값과 같음
+    uint8_t  cont_valid;     // 1: 마지막 명령이 RAMWR/RAMWRC라 written 위치에서 RAMWRC로 이어 쓸 수 있음
+    uint32_t written;        // 마지막 RAMWR 이후 보낸 픽셀 수 (패널 창 시작점 기준 쓰기 위치)
+    uint32_t skipped_bytes;  // 캐시 덕분에 생략한 명령/파라미터 바이트 수
+} ili9341_win;
+
+// 저전력 모드 상태
+static uint8_t  ili9341_sleeping = 0;          // 1: Sleep In 상태
+static uint32_t ili9341_sleep_cmd_ms = 0;      // 마지막 SLPIN/SLPOUT 전송 시각 (ms_uptime)
 /**
   * @brief ILI9341 제어 핀들을 GPIO 출력으로 초기화
   */
@@ -16,26 +43,27 @@ void ILI9341_init_pins(void) {
 
 // ILI9341_CS 핀 제어
 void ILI9341_CS_Enable(void) {
-    GPIO_WritePin(ILI9341_CS_PORT, ILI9341_CS_PIN, GPIO_PIN_RESET); // CS LOW (칩 선택)
+    LCD_BUS_wait(); // DMA로 보내던 픽셀이 남아 있으면 끝날 때까지 대기 (CS는 DMA 완료 콜백이 해제)
+    ILI9341_PIN_WRITE(ILI9341_CS_PORT, ILI9341_CS_PIN, GPIO_PIN_RESET); // CS LOW (칩 선택)
 }
 void ILI9341_CS_Disable(void) {
-    GPIO_WritePin(ILI9341_CS_PORT, ILI9341_CS_PIN, GPIO_PIN_SET);   // CS HIGH (칩 선택 해제)
+    ILI9341_PIN_WRITE(ILI9341_CS_PORT, ILI9341_CS_PIN, GPIO_PIN_SET);   // CS HIGH (칩 선택 해제)
 }
 
 // ILI9341_DC 핀 제어
 void ILI9341_DC_Set(void) {
-    GPIO_WritePin(ILI9341_DC_PORT, ILI9341_DC_PIN, GPIO_PIN_SET);   // DC HIGH (데이터 모드)
+    ILI9341_PIN_WRITE(ILI9341_DC_PORT, ILI9341_DC_PIN, GPIO_PIN_SET);   // DC HIGH (데이터 모드)
 }
 void ILI9341_DC_Reset(void) {
-    GPIO_WritePin(ILI9341_DC_PORT, ILI9341_DC_PIN, GPIO_PIN_RESET); // DC LOW (명령 모드)
+    ILI9341_PIN_WRITE(ILI9341_DC_PORT, ILI9341_DC_PIN, GPIO_PIN_RESET); // DC LOW (명령 모드)
 }
 
 // ILI9341_RST 핀 제어
 void ILI9341_RST_Set(void) {
-    GPIO_WritePin(ILI9341_RST_PORT, ILI9341_RST_PIN, GPIO_PIN_SET); // RST HIGH
+    ILI9341_PIN_WRITE(ILI9341_RST_PORT, ILI9341_RST_PIN, GPIO_PIN_SET); // RST HIGH
 }
 void ILI9341_RST_Reset(void) {
-    GPIO_WritePin(ILI9341_RST_PORT, ILI9341_RST_PIN, GPIO_PIN_RESET); // RST LOW
+    ILI9341_PIN_WRITE(ILI9341_RST_PORT, ILI9341_RST_PIN, GPIO_PIN_RESET); // RST LOW
 }
 
 
@@ -45,8 +73,9 @@ void ILI9341_RST_Reset(void) {
   */
 void ILI9341_WriteCommand(uint8_t cmd) {
     ILI9341_CS_Enable();  // CS LOW
+    ili9341_win.cont_valid = 0; // 다른 명령이 끼면 RAMWRC 이어쓰기 위치를 보장할 수 없음 (버스를 잡은 뒤에 지워야 큐 DMA가 다시 켜지 않음)
     ILI9341_DC_Reset(); // DC LOW (명령 모드)
-    SPI1_transfer(cmd);   // SPI로 명령 전송
+    LCD_BUS_write(&cmd, 1);  // SPI로 명령 전송 (마지막 비트가 나갈 때까지 대기)
     ILI9341_CS_Disable(); // CS HIGH
 }
 
@@ -57,271 +86,740 @@ void ILI9341_WriteCommand(uint8_t cmd) {
 void ILI9341_WriteData(uint8_t data) {
     ILI9341_CS_Enable();  // CS LOW
     ILI9341_DC_Set();     // DC HIGH (데이터 모드)
-    SPI1_transfer(data);  // SPI로 데이터 전송
+    LCD_BUS_write(&data, 1); // SPI로 데이터 전송 (마지막 비트가 나갈 때까지 대기)
     ILI9341_CS_Disable(); // CS HIGH
 }
 
 
 /**
-  * @brief ILI9341 LCD 초기화 시퀀스 (데이터시트 참조)
+  * @brief  CS가 이미 LOW인 상태에서 명령 바이트와 파라미터 바이트들을 전송
+  *         (명령 후 DC는 HIGH로 남으므로 RAMWR 뒤에는 바로 픽셀 데이터를 보낼 수 있음)
+  * @param  cmd: 명령 (8비트)
+  * @param  params: 파라미터 바이트 배열 (len이 0이면 NULL 가능)
+  * @param  len: 파라미터 바이트 수
   */
-void ILI9341_init(void) {
-    // 1. 하드웨어 리셋
-    ILI9341_RST_Set();   // RST HIGH
-    delay_ms(5);
-    ILI9341_RST_Reset(); // RST LOW
-    delay_ms(20);
-    ILI9341_RST_Set();   // RST HIGH
-    delay_ms(150);       // 리셋 후 대기
-
-    // 2. 소프트웨어 리셋
-    ILI9341_WriteCommand(ILI9341_SWRESET); // 소프트웨어 리셋 명령
-    delay_ms(150);
-
-    // 3. Sleep Out
-    ILI9341_WriteCommand(ILI9341_SLPOUT); // Sleep Out 명령
-    delay_ms(150);
-
-    // 4. Power Control A
-    ILI9341_WriteCommand(0xCB);
-    ILI9341_WriteData(0x39);
-    ILI9341_WriteData(0x2C);
-    ILI9341_WriteData(0x00);
-    ILI9341_WriteData(0x34);
-    ILI9341_WriteData(0x02);
-
-    // 5. Power Control B
-    ILI9341_WriteCommand(0xCF);
-    ILI9341_WriteData(0x00);
-    ILI9341_WriteData(0xC1);
-    ILI9341_WriteData(0x30);
-
-    // 6. Driver timing control A
-    ILI9341_WriteCommand(0xE8);
-    ILI9341_WriteData(0x85);
-    ILI9341_WriteData(0x00);
-    ILI9341_WriteData(0x78);
-
-    // 7. Driver timing control B
-    ILI9341_WriteCommand(0xEA);
-    ILI9341_WriteData(0x00);
-    ILI9341_WriteData(0x00);
-
-    // 8. Power on Sequence control
-    ILI9341_WriteCommand(0xED);
-    ILI9341_WriteData(0x64);
-    ILI9341_WriteData(0x03);
-    ILI9341_WriteData(0x12);
-    ILI9341_WriteData(0x81);
-
-    // 9. Pump ratio control
-    ILI9341_WriteCommand(0xF7);
-    ILI9341_WriteData(0x20);
-
-    // 10. Power Control 1 (Vcore)
-    ILI9341_WriteCommand(ILI9341_PWCTR1);
-    ILI9341_WriteData(0x23); // VRH[5:0]
-
-    // 11. Power Control 2 (VGH, VGL)
-    ILI9341_WriteCommand(ILI9341_PWCTR2);
-    ILI9341_WriteData(0x10); // SAP[2:0];BT[3:0]
-
-    // 12. VCOM Control 1
-    ILI9341_WriteCommand(ILI9341_VMCTR1);
-    ILI9341_WriteData(0x3E); // VMF[6:0]
-    ILI9341_WriteData(0x28); // VML[6:0]
-    // 13. VCOM Control 2
-    ILI9341_WriteCommand(0xC7);
-    ILI9341_WriteData(0x86); // VMF
-
-    // 14. Memory Access Control (MADCTL)
-    ILI9341_WriteCommand(ILI9341_MADCTL);
+static void ILI9341_SendCommand(uint8_t cmd, const uint8_t *params, uint8_t len) {
+    ILI9341_DC_Reset();   // DC LOW (명령 모드)
+    LCD_BUS_write(&cmd, 1);  // 명령 바이트가 완전히 나간 뒤에 DC 변경
+    ILI9341_DC_Set();     // DC HIGH (데이터 모드)
+    LCD_BUS_write(params, len);
+}
+
+/**
+  * @brief  명령 + N개의 파라미터를 한 번의 CS 구간으로 전송
+  * @param  cmd: 명령 (8비트)
+  * @param  params: 파라미터 바이트 배열 (len이 0이면 NULL 가능)
+  * @param  len: 파라미터 바이트 수
+  */
+void ILI9341_WriteCommandData(uint8_t cmd, const uint8_t *params, uint8_t len) {
+    ILI9341_CS_Enable();  // CS LOW
+    ili9341_win.cont_valid = 0; // 다른 명령이 끼면 RAMWRC 이어쓰기 위치를 보장할 수 없음 (버스를 잡은 뒤에 지워야 큐 DMA가 다시 켜지 않음)
+    ILI9341_SendCommand(cmd, params, len);
+    ILI9341_CS_Disable(); // CS HIGH
+}
+
+/**
+  * @brief  주소 창 캐시 무효화 (리셋/MADCTL 변경 후 다음 창 설정은 CASET/PASET을 모두 보냄)
+  *         진행 중인 큐 DMA 체인이 SendWindow로 캐시를 다시 채우지 않도록 버스가 비어 있을 때(CS를 잡은 뒤) 호출할 것.
+  */
+static void ILI9341_InvalidateWindow(void) {
+    ili9341_win.col_valid = 0;
+    ili9341_win.row_valid = 0;
+    ili9341_win.cont_valid = 0;
+}
+
+// ILI9341 초기화 테이블 (Flash에 저장)
+// 항목 형식: { 명령, 파라미터 수, 명령 후 대기(ms), 파라미터... }
+// 대기 시간은 데이터시트 최소값: SWRESET 후 5ms, SLPOUT 후 120ms
+static const uint8_t ili9341_init_table[] = {
+    // 1. 소프트웨어 리셋
+    ILI9341_SWRESET, 0, 5,
+    // 2. Sleep Out (전원 회로 안정화까지 120ms)
+    ILI9341_SLPOUT,  0, 120,
+    // 3. Power Control A
+    0xCB, 5, 0, 0x39, 0x2C, 0x00, 0x34, 0x02,
+    // 4. Power Control B
+    0xCF, 3, 0, 0x00, 0xC1, 0x30,
+    // 5. Driver timing control A
+    0xE8, 3, 0, 0x85, 0x00, 0x78,
+    // 6. Driver timing control B
+    0xEA, 2, 0, 0x00, 0x00,
+    // 7. Power on Sequence control
+    0xED, 4, 0, 0x64, 0x03, 0x12, 0x81,
+    // 8. Pump ratio control
+    0xF7, 1, 0, 0x20,
+    // 9. Power Control 1 (Vcore) - VRH[5:0]
+    ILI9341_PWCTR1, 1, 0, 0x23,
+    // 10. Power Control 2 (VGH, VGL) - SAP[2:0];BT[3:0]
+    ILI9341_PWCTR2, 1, 0, 0x10,
+    // 11. VCOM Control 1 - VMF[6:0], VML[6:0]
+    ILI9341_VMCTR1, 2, 0, 0x3E, 0x28,
+    // 12. VCOM Control 2 - VMF
+    0xC7, 1, 0, 0x86,
+    // 13. Memory Access Control (MADCTL)
     // Bit D7: MY (Row Address Order)
     // Bit D6: MX (Column Address Order)
     // Bit D5: MV (Row/Column Exchange) - 1: Exchange, 0: Normal
     // Bit D4: ML (Line Address Order)
     // Bit D3: BGR (RGB/BGR Order) - 1: BGR, 0: RGB
     // Bit D2: MH (Display Data Latch Order)
-    // D5=1, D4=0, D3=1, D2=0, D1=0, D0=0 (0b01001000)
-    // Set for Portrait mode, BGR color order
-    // 0x48 = MX (0), MV (1), MY (0), BGR (1) = Landscape (MV=1)
-    // 0x28 = MX (0), MV (0), MY (0), BGR (1) = Portrait (BGR)
-    // 0x08 = MX (0), MV (0), MY (0), BGR (1) = Portrait (RGB)
-    // For standard portrait (top-down, left-right, BGR): 0b00101000 = 0x28
-    ILI9341_WriteData(0x88); // 기본값: 0x28 (Portrait, BGR)
-
-    // 15. Pixel Format Set
-    ILI9341_WriteCommand(ILI9341_PIXFMT);
-    ILI9341_WriteData(0x55); // 16bit/pixel (RGB565)
-
-    // 16. Frame Rate Control (In Normal Mode/Full Colors)
-    ILI9341_WriteCommand(ILI9341_FRMCTR1);
-    ILI9341_WriteData(0x00);
-    ILI9341_WriteData(0x18); // 70Hz
-
-    // 17. Display Function Control
-    ILI9341_WriteCommand(ILI9341_DFUNCTR);
-    ILI9341_WriteData(0x08); // Display inversion control, normally (0x08)
-    ILI9341_WriteData(0x82); // Gate scan reverse
-    ILI9341_WriteData(0x27);
-
-    // 18. Gamma Function Disable
-    ILI9341_WriteCommand(0xF2);
-    ILI9341_WriteData(0x00);
-
-    // 19. Gamma Correction Positive Pole
-    ILI9341_WriteCommand(ILI9341_GMCTRP1);
-    ILI9341_WriteData(0x0F);
-    ILI9341_WriteData(0x31);
-    ILI9341_WriteData(0x2B);
-    ILI9341_WriteData(0x0C);
-    ILI9341_WriteData(0x0E);
-    ILI9341_WriteData(0x08);
-    ILI9341_WriteData(0x4E);
-    ILI9341_WriteData(0xF1);
-    ILI9341_WriteData(0x37);
-    ILI9341_WriteData(0x07);
-    ILI9341_WriteData(0x10);
-    ILI9341_WriteData(0x03);
-    ILI9341_WriteData(0x0E);
-    ILI9341_WriteData(0x09);
-    ILI9341_WriteData(0x00);
-
-    // 20. Gamma Correction Negative Pole
-    ILI9341_WriteCommand(ILI9341_GMCTRN1);
-    ILI9341_WriteData(0x00);
-    ILI9341_WriteData(0x0E);
-    ILI9341_WriteData(0x14);
-    ILI9341_WriteData(0x03);
-    ILI9341_WriteData(0x11);
-    ILI9341_WriteData(0x07);
-    ILI9341_WriteData(0x31);
-    ILI9341_WriteData(0xC1);
-    ILI9341_WriteData(0x48);
-    ILI9341_WriteData(0x08);
-    ILI9341_WriteData(0x0F);
-    ILI9341_WriteData(0x0C);
-    ILI9341_WriteData(0x31);
-    ILI9341_WriteData(0x36);
-    ILI9341_WriteData(0x0F);
-
-    // 21. Display On
-    ILI9341_WriteCommand(ILI9341_DISPON);
-    delay_ms(150);
-
-}
-
-/**
-  * @brief  LCD의 그리기 영역(Address Window)을 설정
-  * @param  x1, y1: 시작점 좌표
-  * @param  x2, y2: 끝점 좌표
+    // 0x88 = MY (1), MX (0), MV (0), BGR (1) = Portrait (BGR), 회전 0
+    ILI9341_MADCTL, 1, 0, ILI9341_MADCTL_MY | ILI9341_MADCTL_BGR,
+    // 14. Pixel Format Set - 16bit/pixel (RGB565)
+    ILI9341_PIXFMT, 1, 0, 0x55,
+    // 15. Frame Rate Control (In Normal Mode/Full Colors) - 70Hz
+    ILI9341_FRMCTR1, 2, 0, 0x00, 0x18,
+    // 16. Display Function Control - inversion normal (0x08), gate scan reverse (0x82), 0x27
+    ILI9341_DFUNCTR, 3, 0, 0x08, 0x82, 0x27,
+    // 17. Gamma Function Disable
+    0xF2, 1, 0, 0x00,
+    // 18. Gamma Correction Positive Pole
+    ILI9341_GMCTRP1, 15, 0,
+        0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1,
+        0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+    // 19. Gamma Correction Negative Pole
+    ILI9341_GMCTRN1, 15, 0,
+        0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1,
+        0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+    // 20. Display On (대기 불필요)
+    ILI9341_DISPON, 0, 0,
+};
+
+// 마지막 ILI9341_init() 소요 시간 (ms)
+static uint32_t ili9341_init_ms = 0;
+
+/**
+  * @brief ILI9341 LCD 초기화 시퀀스 (데이터시트 참조)
+  *        초기화 테이블을 명령마다 CS 한 번으로 전송하고, 대기 시간은 최소값만 사용.
   */
-void ILI9341_SetAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-    ILI9341_WriteCommand(ILI9341_CASET); // Column Address Set
-    ILI9341_WriteData(x1 >> 8); // X start High
-    ILI9341_WriteData(x1 & 0xFF); // X start Low
-    ILI9341_WriteData(x2 >> 8); // X end High
-    ILI9341_WriteData(x2 & 0xFF); // X end Low
+void ILI9341_init(void) {
+    const uint8_t *p = ili9341_init_table;
+    const uint8_t *end = ili9341_init_table + sizeof(ili9341_init_table);
+    uint32_t start_ms = ms_uptime;
 
-    ILI9341_WriteCommand(ILI9341_PASET); // Page Address Set
-    ILI9341_WriteData(y1 >> 8); // Y start High
-    ILI9341_WriteData(y1 & 0xFF); // Y start Low
-    ILI9341_WriteData(y2 >> 8); // Y end High
-    ILI9341_WriteData(y2 & 0xFF); // Y end Low
+    ILI9341_WaitDone();         // 큐의 DMA 체인을 끝내 버스를 비운 뒤에
+    ILI9341_InvalidateWindow(); // 리셋 후 패널의 창 설정은 기본값으로 돌아감
 
-    ILI9341_WriteCommand(ILI9341_RAMWR); // Memory Write
+    // 하드웨어 리셋: RST LOW 펄스 (최소 10us) 후 5ms 대기
+    ILI9341_RST_Reset(); // RST LOW
+    delay_ms(2);         // SysTick 경계에 따라 delay_ms(1)은 1ms보다 짧을 수 있음
+    ILI9341_RST_Set();   // RST HIGH
+    delay_ms(5);
+
+    while (p < end) {
+        uint8_t cmd   = p[0];
+        uint8_t len   = p[1];
+        uint8_t delay = p[2];
+        ILI9341_WriteCommandData(cmd, p + 3, len);
+        if (delay) delay_ms(delay);
+        p += 3 + len;
+    }
+
+    ili9341_sleep_cmd_ms = ms_uptime;  // 테이블의 SLPOUT 이후 120ms 제약 계산용
+    ili9341_sleeping = 0;
+
+    if (ili9341_rotation != 0) {
+        ILI9341_SetRotation(ili9341_rotation); // 테이블의 MADCTL은 회전 0 기준
+    }
+
+    ili9341_init_ms = ms_uptime - start_ms;
 }
 
 /**
-  * @brief  LCD 화면 전체를 단색으로 채움
-  * @param  color: 채울 색상 (16비트 RGB565)
+  * @brief  마지막 ILI9341_init() 소요 시간 반환
+  * @retval 초기화에 걸린 시간 (ms)
   */
-void ILI9341_FillScreen(uint16_t color) {
-    uint32_t i;
-    ILI9341_SetAddressWindow(0, 0, ILI9341_WIDTH - 1, ILI9341_HEIGHT - 1); // 전체 화면 영역 설정
-    ILI9341_CS_Enable(); // CS LOW
-    ILI9341_DC_Set();     // DC HIGH (데이터 모드)
+uint32_t ILI9341_GetInitTime(void) {
+    return ili9341_init_ms;
+}
 
-    // 모든 픽셀에 색상 데이터 전송
-    for (i = 0; i < (uint32_t)ILI9341_WIDTH * ILI9341_HEIGHT; i++) {
-        SPI1_transfer(color >> 8);   // High byte
-        SPI1_transfer(color & 0xFF); // Low byte
-    }
+// 회전 방향별 MADCTL 값 (90도씩 시계 방향)
+static const uint8_t ili9341_madctl_rotation[4] = {
+    ILI9341_MADCTL_MY | ILI9341_MADCTL_BGR,                                          // 0: 240x320 세로
+    ILI9341_MADCTL_MY | ILI9341_MADCTL_MX | ILI9341_MADCTL_MV | ILI9341_MADCTL_BGR,  // 1: 320x240 가로
+    ILI9341_MADCTL_MX | ILI9341_MADCTL_BGR,                                          // 2: 240x320 세로 (180도)
+    ILI9341_MADCTL_MV | ILI9341_MADCTL_BGR,                                          // 3: 320x240 가로 (270도)
+};
+
+/**
+  * @brief  화면 회전 설정: MADCTL을 다시 쓰고 논리 가로/세로 크기를 갱신
+  *         회전은 컨트롤러가 처리하므로 픽셀 전송 속도는 그대로다.
+  * @param  rotation: 0 ~ 3 (90도 단위, 4 이상은 나머지로 처리)
+  */
+void ILI9341_SetRotation(uint8_t rotation) {
+    rotation &= 0x03;
+    ILI9341_CS_Enable();  // CS LOW (버스를 잡은 상태에서 캐시를 무효화)
+    ILI9341_SendCommand(ILI9341_MADCTL, &ili9341_madctl_rotation[rotation], 1);
+    ILI9341_InvalidateWindow();
     ILI9341_CS_Disable(); // CS HIGH
+
+    ili9341_rotation = rotation;
+    if (rotation & 0x01) {  // 가로 방향: 행/열 교환 (MV)
+        ili9341_width  = ILI9341_HEIGHT;
+        ili9341_height = ILI9341_WIDTH;
+    } else {
+        ili9341_width  = ILI9341_WIDTH;
+        ili9341_height = ILI9341_HEIGHT;
+    }
 }
 
 /**
-  * @brief  단일 픽셀을 그림
-  * @param  x, y: 픽셀 좌표
-  * @param  color: 픽셀 색상 (16비트 RGB565)
+  * @brief  현재 회전 방향 반환 (0 ~ 3)
   */
-void ILI9341_DrawPixel(uint16_t x, uint16_t y, uint16_t color) {
-    // 좌표가 화면 범위를 벗어나면 그리지 않음
-    if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT) return;
+uint8_t ILI9341_GetRotation(void) {
+    return ili9341_rotation;
+}
 
-    ILI9341_SetAddressWindow(x, y, x, y); // 단일 픽셀 영역 설정
+/**
+  * @brief  현재 회전 방향 기준의 화면 가로 픽셀 수
+  */
+uint16_t ILI9341_GetWidth(void) {
+    return ili9341_width;
+}
+
+/**
+  * @brief  현재 회전 방향 기준의 화면 세로 픽셀 수
+  */
+uint16_t ILI9341_GetHeight(void) {
+    return ili9341_height;
+}
+
+/**
+  * @brief  요청한 창이 직전 쓰기 창의 남은 부분과 정확히 같은지 확인
+  *         열 범위와 끝 행이 같고, 시작 행이 직전 RAMWR 이후 쓴 픽셀 수로 계산한 쓰기 위치(행 경계)와 같아야 한다.
+  * @retval 1: RAMWRC로 이어 쓰면 요청한 창에 그대로 써짐, 0: 창을 새로 잡아야 함
+  */
+static uint8_t ILI9341_WindowContinues(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    uint32_t cols, pos;
+
+    if (!ili9341_win.cont_valid) return 0;
+    if (x1 != ili9341_win.x1 || x2 != ili9341_win.x2 || y2 != ili9341_win.y2) return 0;
+    if (y1 <= ili9341_win.y1 || y1 > y2) return 0; // 같은 창을 처음부터 쓰면 RAMWR(1바이트)로 충분
+    cols = (uint32_t)(x2 - x1 + 1);
+    pos = ili9341_win.written % (cols * (uint32_t)(ili9341_win.y2 - ili9341_win.y1 + 1)); // 창 끝에서 처음으로 돌아감
+    return pos == (uint32_t)(y1 - ili9341_win.y1) * cols;
+}
+
+/**
+  * @brief  CS가 이미 LOW인 상태에서 CASET/PASET + 메모리 명령 전송 (끝나면 DC HIGH, 픽셀 데이터 대기)
+  *         패널에 마지막으로 설정한 열/행 범위를 캐시해 두고 바뀐 쪽만 보낸다.
+  *         (같은 열의 세로 띠, 같은 행의 글자 열 등은 5바이트, 같은 창을 다시 그리면 RAMWR 1바이트)
+  *         직전 쓰기가 멈춘 행부터 같은 창의 나머지를 쓰는 경우에는 Memory Write Continue(0x3C) 1바이트만 보낸다.
+  * @param  mem_cmd: ILI9341_RAMWR (쓰기) 또는 ILI9341_RAMRD (읽기)
+  */
+static void ILI9341_SendWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint8_t mem_cmd) {
+    if (mem_cmd == ILI9341_RAMWR && ILI9341_WindowContinues(x1, y1, x2, y2)) {
+        // 패널 창은 예전 그대로(y1이 더 위)지만 쓰기 위치가 요청한 y1 행 시작이므로 결과는 같다
+        ILI9341_SendCommand(ILI9341_RAMWRC, 0, 0);
+        ili9341_win.skipped_bytes += 10; // CASET/PASET 생략
+        return;
+    }
+    if (!ili9341_win.col_valid || ili9341_win.x1 != x1 || ili9341_win.x2 != x2) {
+        uint8_t col[4] = { x1 >> 8, x1 & 0xFF, x2 >> 8, x2 & 0xFF }; // X start/end (High, Low)
+        ILI9341_SendCommand(ILI9341_CASET, col, 4); // Column Address Set
+        ili9341_win.x1 = x1;
+        ili9341_win.x2 = x2;
+        ili9341_win.col_valid = 1;
+    } else {
+        ili9341_win.skipped_bytes += 5;
+    }
+    if (!ili9341_win.row_valid || ili9341_win.y1 != y1 || ili9341_win.y2 != y2) {
+        uint8_t row[4] = { y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF }; // Y start/end (High, Low)
+        ILI9341_SendCommand(ILI9341_PASET, row, 4); // Page Address Set
+        ili9341_win.y1 = y1;
+        ili9341_win.y2 = y2;
+        ili9341_win.row_valid = 1;
+    } else {
+        ili9341_win.skipped_bytes += 5;
+    }
+    ILI9341_SendCommand(mem_cmd, 0, 0);         // Memory Write / Memory Read
+    ili9341_win.cont_valid = (mem_cmd == ILI9341_RAMWR); // 읽기 후에는 쓰기 위치를 알 수 없음
+    ili9341_win.written = 0;
+}
+
+/**
+  * @brief  LCD의 그리기 영역(Address Window)을 설정 (CASET+PASET+RAMWR을 CS 한 번으로)
+  *         이후 직접 보낸 픽셀은 ILI9341_AdvanceWrite()로 알려야 RAMWRC 이어쓰기 위치가 맞는다.
+  * @param  x1, y1: 시작점 좌표
+  * @param  x2, y2: 끝점 좌표
+  */
+void ILI9341_SetAddressWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
     ILI9341_CS_Enable();  // CS LOW
-    ILI9341_DC_Set();     // DC HIGH
-    SPI1_transfer(color >> 8);   // High byte
-    SPI1_transfer(color & 0xFF); // Low byte
+    ILI9341_SendWindow(x1, y1, x2, y2, ILI9341_RAMWR);
     ILI9341_CS_Disable(); // CS HIGH
 }
 
 /**
-  * @brief  직사각형을 그림
+  * @brief  픽셀 쓰기 트랜잭션 시작: CS LOW -> 영역 설정 -> RAMWR -> DC HIGH
+  *         CS는 LOW로 남으므로 바로 픽셀 데이터를 보내고 ILI9341_EndWrite()로 끝낸다.
+  * @param  x1, y1: 시작점 좌표
+  * @param  x2, y2: 끝점 좌표
+  */
+void ILI9341_BeginWrite(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    ILI9341_CS_Enable();  // CS LOW
+    ILI9341_SendWindow(x1, y1, x2, y2, ILI9341_RAMWR);
+}
+
+/**
+  * @brief  BeginWrite로 연 창에 호출자가 LCD_BUS_*로 직접 보낸 픽셀 수를 알림 (RAMWRC 이어쓰기 위치 추적)
+  * @param  count: 보낸 픽셀 수
+  */
+void ILI9341_AdvanceWrite(uint32_t count) {
+    ili9341_win.written += count;
+}
+
+/**
+  * @brief  픽셀 쓰기 트랜잭션 종료 (CS HIGH)
+  */
+void ILI9341_EndWrite(void) {
+    ILI9341_CS_Disable(); // CS HIGH
+}
+
+/**
+  * @brief  DMA 픽셀 전송이 진행 중인지 확인
+  * @retval 1: 전송 중 (CS LOW 유지), 0: 유휴
+  */
+uint8_t ILI9341_IsBusy(void) {
+    return LCD_BUS_busy();
+}
+
+/**
+  * @brief  DMA 픽셀 전송이 끝날 때까지 대기
+  */
+void ILI9341_WaitDone(void) {
+    LCD_BUS_wait();
+}
+
+/**
+  * @brief  단색 직사각형 채우기 (DMA, 비블로킹). 클리핑은 호출자가 끝낸 상태여야 한다.
   * @param  x, y: 시작 좌표
-  * @param  w, h: 가로, 세로 길이
+  * @param  w, h: 가로, 세로 길이 (0이 아니어야 함)
   * @param  color: 색상 (16비트 RGB565)
   */
-void ILI9341_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-    if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT || w == 0 || h == 0) return;
-    if (x + w > ILI9341_WIDTH) w = ILI9341_WIDTH - x;
-    if (y + h > ILI9341_HEIGHT) h = ILI9341_HEIGHT - y;
+void ILI9341_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    uint32_t count = (uint32_t)w * h;
+
+    ILI9341_BeginWrite(x, y, x + w - 1, y + h - 1); // 직사각형 영역 설정
+    ili9341_win.written += count;
+
+    if (count <= ILI9341_STREAM_CPU_MAX) {
+        // 선의 짧은 run처럼 몇 픽셀 안 되면 DMA 설정/완료 인터럽트 없이 CPU로 바로 전송
+        uint16_t run[ILI9341_STREAM_CPU_MAX];
+        uint32_t i;   // count와 같은 폭 (ILI9341_STREAM_CPU_MAX를 256 이상으로 바꿔도 안전)
+        for (i = 0; i < count; i++) run[i] = color;
+        LCD_BUS_pixel_mode();
+        LCD_BUS_write16(run, count);
+        LCD_BUS_byte_mode();
+        ILI9341_EndWrite();
+        return;
+    }
+
+    // 단색 영역은 DMA로 전송. CPU는 바로 돌아가고, 완료 콜백에서 CS HIGH.
+    LCD_BUS_fill16(color, count, ILI9341_EndWrite);
+}
+
+// ====================================================================
+// ==== 핑퐁 라인 버퍼 파이프라인 (SPI1 DMA) ==========================
+// 병렬 버스(LCD_BUS_PAR8)에서는 전송이 CPU로 끝나므로 겹침 없이 순서대로 처리된다.
+// ====================================================================
+// CPU가 버퍼 A를 채우는 동안 DMA가 버퍼 B를 SPI로 내보낸다.
+static uint16_t ili9341_linebuf[2][ILI9341_LINEBUF_PIXELS];
+static uint8_t  ili9341_linebuf_idx = 0; // CPU가 다음에 채울 버퍼 번호
+
+/**
+  * @brief  라인 버퍼 스트림 시작: 영역 설정 + RAMWR 후 버스를 픽셀(16비트) 모드로 전환
+  * @param  x1, y1: 시작점 좌표
+  * @param  x2, y2: 끝점 좌표
+  */
+void ILI9341_StreamBegin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    ILI9341_BeginWrite(x1, y1, x2, y2);
+    LCD_BUS_pixel_mode();
+    ili9341_linebuf_idx = 0;
+}
+
+/**
+  * @brief  주소 창 캐시로 생략한 명령/파라미터 바이트 수 (튜닝용)
+  */
+uint32_t ILI9341_GetSkippedSetupBytes(void) {
+    return ili9341_win.skipped_bytes;
+}
 
-    ILI9341_SetAddressWindow(x, y, x + w - 1, y + h - 1); // 직사각형 영역 설정
-    ILI9341_CS_Enable(); // CS LOW
-    ILI9341_DC_Set();     // DC HIGH
+/**
+  * @brief  CPU가 채울 수 있는 라인 버퍼 반환 (ILI9341_LINEBUF_PIXELS 픽셀)
+  *         이 버퍼는 직전 DMA가 보내고 있는 버퍼와 다르므로 바로 채워도 된다.
+  */
+uint16_t *ILI9341_StreamBuffer(void) {
+    return ili9341_linebuf[ili9341_linebuf_idx];
+}
 
-    for (uint32_t i = 0; i < (uint32_t)w * h; i++) {
-        SPI1_transfer(color >> 8);   // High byte
-        SPI1_transfer(color & 0xFF); // Low byte
+/**
+  * @brief  채운 라인 버퍼를 DMA로 전송하고 다른 버퍼로 교체
+  *         직전 버퍼의 DMA가 끝날 때까지만 기다리므로, 생성과 전송이 겹쳐서 진행된다.
+  *         ILI9341_STREAM_CPU_MAX 이하의 짧은 전송은 CPU로 바로 보낸다.
+  * @param  count: 버퍼에 채운 픽셀 수 (ILI9341_LINEBUF_PIXELS 이하)
+  */
+void ILI9341_StreamSubmit(uint16_t count) {
+    if (count <= ILI9341_STREAM_CPU_MAX) {
+        // 몇 픽셀 안 되면 DMA 설정/인터럽트 비용이 더 크므로 CPU로 바로 전송
+        LCD_BUS_wait();
+        LCD_BUS_write16(ili9341_linebuf[ili9341_linebuf_idx], count);
+    } else {
+        LCD_BUS_write16_async(ili9341_linebuf[ili9341_linebuf_idx], count, 0);
     }
-    ILI9341_CS_Disable(); // CS HIGH
+    ili9341_win.written += count;
+    ili9341_linebuf_idx ^= 1;
 }
-// main.c (ILI9341 LCD 드라이버 통합 섹션)
 
-// ... (기존 ILI9341_DrawRectangle 함수 이후에 추가) ...
+/**
+  * @brief  호출자 메모리의 RGB565 픽셀을 복사 없이 DMA로 바로 전송 (스트림 중에 사용)
+  *         DMA가 끝날 때까지 pixels 내용을 바꾸면 안 된다. 다음 전송/StreamEnd가 완료를 기다린다.
+  * @param  pixels: RGB565 픽셀 배열
+  * @param  count: 픽셀 수
+  */
+void ILI9341_StreamWrite(const uint16_t *pixels, uint32_t count) {
+    LCD_BUS_write16_async(pixels, count, 0);
+    ili9341_win.written += count;
+}
 
 /**
-  * @brief  화면에 이미지를 그림
-  * @param  x: 이미지를 그릴 시작 X 좌표
-  * @param  y: 이미지를 그릴 시작 Y 좌표
-  * @param  w: 이미지의 가로 길이 (픽셀)
-  * @param  h: 이미지의 세로 길이 (픽셀)
-  * @param  image_data: RGB565 형식의 픽셀 데이터 배열 포인터
+  * @brief  스트림 종료: 남은 DMA 완료 대기 -> 8비트 모드 복귀 -> CS HIGH
   */
-void ILI9341_DrawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char *image_data) {
-    uint32_t total_pixels = (uint32_t)w * h;
-    uint32_t i;
-    const uint8_t *current_pixel_data = image_data; // 현재 픽셀 데이터 포인터
+void ILI9341_StreamEnd(void) {
+    LCD_BUS_wait();
+    LCD_BUS_byte_mode();
+    ILI9341_EndWrite();
+}
 
-    // 이미지가 화면 범위를 벗어나지 않도록 클리핑
-    if (x >= ILI9341_WIDTH || y >= ILI9341_HEIGHT || w == 0 || h == 0) return;
-    if (x + w > ILI9341_WIDTH) w = ILI9341_WIDTH - x;
-    if (y + h > ILI9341_HEIGHT) h = ILI9341_HEIGHT - y;
+/**
+  * @brief  GRAM에서 픽셀을 읽어 RGB565로 변환 (RAMRD, 0x2E)
+  *         패널은 더미 1바이트 후 픽셀당 R, G, B 3바이트(각 상위 6비트 유효, RGB666)를 보낸다.
+  *         읽기 구간에서는 SPI 클럭을 SPI1_READ_PRESCALER로 낮췄다가 복귀한다 (병렬 버스는 데이터 핀을 입력으로 전환).
+  * @param  x, y: 읽기 시작 좌표
+  * @param  w, h: 읽을 영역의 가로, 세로 길이
+  * @param  buf: RGB565 픽셀을 저장할 버퍼 (w * h 개, 클리핑된 경우 클리핑된 영역 기준)
+  */
+void ILI9341_ReadPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *buf) {
+    uint8_t rgb[3 * ILI9341_READ_CHUNK];
+    uint32_t left, n, i;
 
-    // 이미지가 그려질 영역 설정
-    ILI9341_SetAddressWindow(x, y, x + w - 1, y + h - 1);
+    if (x >= ili9341_width || y >= ili9341_height || w == 0 || h == 0) return;
+    if (x + w > ili9341_width) w = ili9341_width - x;
+    if (y + h > ili9341_height) h = ili9341_height - y;
 
     ILI9341_CS_Enable();  // CS LOW
-    ILI9341_DC_Set();     // DC HIGH (데이터 모드)
-
-    // 모든 픽셀 데이터를 순서대로 전송
-    for (i = 0; i < total_pixels; i++) {
-        // 픽셀 1개는 2바이트 (RGB565). uint8_t 배열에서는 두 번의 SPI 전송으로 픽셀 1개를 구성.
-        // 현재 이미지 데이터 배열은 High Byte 먼저, Low Byte 나중 순서로 되어 있다고 가정.
-        SPI1_transfer(*current_pixel_data++);   // High byte 전송 (예: 0x10)
-        SPI1_transfer(*current_pixel_data++);   // Low byte 전송 (예: 0xC4)
+    ILI9341_SendWindow(x, y, x + w - 1, y + h - 1, ILI9341_RAMRD);
+    LCD_BUS_read_begin();
+
+    LCD_BUS_read(rgb, 1);    // 더미 읽기 사이클
+    // 호출마다 드는 RX 플러시/BSY 대기를 줄이도록 ILI9341_READ_CHUNK 픽셀씩 한 번에 읽은 뒤 변환
+    for (left = (uint32_t)w * h; left; left -= n) {
+        n = (left < ILI9341_READ_CHUNK) ? left : ILI9341_READ_CHUNK;
+        LCD_BUS_read(rgb, 3 * n);
+        for (i = 0; i < 3 * n; i += 3) {
+            *buf++ = ((uint16_t)(rgb[i] & 0xF8) << 8) | ((uint16_t)(rgb[i + 1] & 0xFC) << 3) | (rgb[i + 2] >> 3);
+        }
     }
+
+    LCD_BUS_read_end();
     ILI9341_CS_Disable(); // CS HIGH
 }
+
+/**
+  * @brief  GRAM에서 픽셀 하나를 읽음
+  * @param  x, y: 픽셀 좌표
+  * @retval RGB565 색상 (범위 밖이면 0)
+  */
+uint16_t ILI9341_ReadPixel(uint16_t x, uint16_t y) {
+    uint16_t color = 0;
+    ILI9341_ReadPixels(x, y, 1, 1, &color);
+    return color;
+}
+
+// ====================================================================
+// ==== 하드웨어 세로 스크롤 (VSCRDEF / VSCRSADD) =====================
+// ====================================================================
+// 패널 게이트 방향(320줄)을 위쪽 고정 영역(TFA) + 스크롤 영역(VSA) + 아래쪽 고정 영역(BFA)으로 나눈다.
+// 스크롤하면 화면의 논리 행과 GRAM 행이 어긋나므로 ILI9341_ScrollMapRow()로 변환해서 그린다.
+// 하드웨어 스크롤은 게이트 방향으로만 동작하므로 세로 방향(회전 0/2)에서 사용한다.
+// VSCRDEF/VSCRSADD는 GRAM 행 기준이고, MADCTL MY=1(회전 0)이면 논리 행 y가 GRAM 행 319-y에 들어간다.
+// 아래 상태는 모두 논리 행 기준으로 두고, 패널에 보낼 때만 GRAM 행 기준으로 뒤집는다.
+// (회전을 0 <-> 2로 바꾼 뒤에는 ILI9341_SetScrollArea()를 다시 호출할 것)
+static uint16_t ili9341_scroll_tfa = 0;              // 위쪽 고정 영역 줄 수 (논리 행 기준)
+static uint16_t ili9341_scroll_vsa = ILI9341_HEIGHT; // 스크롤 영역 줄 수
+static uint16_t ili9341_scroll_offset = 0;           // 스크롤 영역 안에서의 현재 오프셋 (0 ~ VSA-1, 논리 행 기준)
+
+/**
+  * @brief  현재 회전에서 논리 행과 GRAM 행의 순서가 반대인지 (MADCTL MY)
+  */
+static uint8_t ILI9341_ScrollMirrored(void) {
+    return (ili9341_madctl_rotation[ili9341_rotation] & ILI9341_MADCTL_MY) != 0;
+}
+
+/**
+  * @brief  스크롤 영역 정의 (VSCRDEF) 후 스크롤 위치를 0으로 초기화 (세로 회전 0/2에서만 동작)
+  * @param  top_fixed: 위쪽 고정 영역 줄 수 (상태 표시줄 등)
+  * @param  bottom_fixed: 아래쪽 고정 영역 줄 수
+  */
+void ILI9341_SetScrollArea(uint16_t top_fixed, uint16_t bottom_fixed) {
+    uint16_t vsa;
+    uint8_t params[6];
+
+    if (ili9341_rotation & 1) return; // 하드웨어 스크롤은 세로 방향(게이트 행) 전용, 가로 회전에서는 지원 안 함
+    if (top_fixed + bottom_fixed >= ILI9341_HEIGHT) return; // 스크롤 영역이 최소 1줄은 있어야 함
+    vsa = ILI9341_HEIGHT - top_fixed - bottom_fixed;
+
+    if (ILI9341_ScrollMirrored()) { // GRAM 기준으로는 화면 위쪽 고정 영역이 BFA가 됨
+        uint16_t tmp = top_fixed;
+        top_fixed = bottom_fixed;
+        bottom_fixed = tmp;
+    }
+    params[0] = top_fixed >> 8;    params[1] = top_fixed & 0xFF;    // TFA (GRAM 행 기준)
+    params[2] = vsa >> 8;          params[3] = vsa & 0xFF;          // VSA
+    params[4] = bottom_fixed >> 8; params[5] = bottom_fixed & 0xFF; // BFA (GRAM 행 기준)
+    ILI9341_WriteCommandData(ILI9341_VSCRDEF, params, 6);
+
+    ili9341_scroll_tfa = ILI9341_ScrollMirrored() ? bottom_fixed : top_fixed; // 논리 행 기준 위쪽 고정 영역
+    ili9341_scroll_vsa = vsa;
+    ILI9341_ScrollTo(0);
+}
+
+/**
+  * @brief  스크롤 위치 설정 (VSCRSADD). 스크롤 영역의 offset번째 논리 행이 영역 맨 위에 표시된다.
+  *         MADCTL MY=1이면 GRAM 행 순서가 반대이므로 GRAM 기준 오프셋은 VSA - offset이 된다.
+  * @param  offset: 스크롤 영역 안에서의 오프셋 (VSA 이상이면 나머지로 감음)
+  */
+void ILI9341_ScrollTo(uint16_t offset) {
+    uint16_t vsp;
+    uint8_t params[2];
+
+    ili9341_scroll_offset = offset % ili9341_scroll_vsa;
+    if (ILI9341_ScrollMirrored()) {
+        // GRAM 기준 TFA = 논리 아래쪽 고정 영역 줄 수
+        vsp = (ILI9341_HEIGHT - ili9341_scroll_tfa - ili9341_scroll_vsa) +
+              (ili9341_scroll_vsa - ili9341_scroll_offset) % ili9341_scroll_vsa;
+    } else {
+        vsp = ili9341_scroll_tfa + ili9341_scroll_offset;
+    }
+    params[0] = vsp >> 8;
+    params[1] = vsp & 0xFF;
+    ILI9341_WriteCommandData(ILI9341_VSCRSADD, params, 2);
+}
+
+/**
+  * @brief  현재 스크롤 오프셋 반환
+  */
+uint16_t ILI9341_GetScrollOffset(void) {
+    return ili9341_scroll_offset;
+}
+
+/**
+  * @brief  화면에 보이는 논리 행을 그 위치에 표시되는 페이지 주소(그리기 좌표의 행)로 변환
+  *         고정 영역은 그대로, 스크롤 영역은 현재 오프셋만큼 돌려서 계산한다.
+  *         MADCTL MY에 따른 GRAM 행 반전은 SetScrollArea/ScrollTo가 패널 명령에서 처리하므로 여기서는 신경 쓰지 않는다.
+  *         스크롤 중에도 이 값으로 그리면 원하는 화면 위치에 나타난다.
+  *         (여러 줄에 걸친 영역은 스크롤 영역 끝에서 GRAM이 감기므로 두 번으로 나눠 그릴 것)
+  * @param  y: 화면상의 행 (0 ~ ILI9341_HEIGHT-1)
+  * @retval 그릴 때 사용할 행 (ILI9341_FillRect 등의 y)
+  */
+uint16_t ILI9341_ScrollMapRow(uint16_t y) {
+    uint16_t rel;
+    if (y < ili9341_scroll_tfa || y >= ili9341_scroll_tfa + ili9341_scroll_vsa) return y;
+    rel = y - ili9341_scroll_tfa + ili9341_scroll_offset;
+    if (rel >= ili9341_scroll_vsa) rel -= ili9341_scroll_vsa;
+    return ili9341_scroll_tfa + rel;
+}
+
+/**
+  * @brief  스크롤 영역을 lines줄 위로 올리고, 아래에 새로 드러난 줄을 배경색으로 지움 (세로 회전 0/2에서만 동작)
+  *         스크롤 로그/차트는 이후 스크롤 영역 맨 아래 lines줄만 새로 그리면 된다.
+  * @param  lines: 올릴 줄 수 (VSA 이하)
+  * @param  bg_color: 새로 드러난 줄을 채울 색상
+  */
+void ILI9341_ScrollAdvance(uint16_t lines, uint16_t bg_color) {
+    uint16_t first, to_end;
+
+    if (lines == 0 || (ili9341_rotation & 1)) return; // 가로 회전에서는 FillRect 좌표가 GRAM 행과 맞지 않음
+    if (lines > ili9341_scroll_vsa) lines = ili9341_scroll_vsa;
+
+    // 이전 화면의 맨 위 lines줄이 새 화면의 맨 아래로 돌아오므로 그 행을 지운다 (논리 행 기준, MY 반전은 ScrollTo가 처리)
+    first = ili9341_scroll_offset;
+    to_end = ili9341_scroll_vsa - first;
+    if (lines <= to_end) {
+        ILI9341_FillRect(0, ili9341_scroll_tfa + first, ILI9341_WIDTH, lines, bg_color);
+    } else {
+        ILI9341_FillRect(0, ili9341_scroll_tfa + first, ILI9341_WIDTH, to_end, bg_color);
+        ILI9341_FillRect(0, ili9341_scroll_tfa, ILI9341_WIDTH, lines - to_end, bg_color);
+    }
+    ILI9341_ScrollTo(ili9341_scroll_offset + lines);
+}
+
+// ====================================================================
+// ==== Tearing Effect (TE) 동기화 ====================================
+// ====================================================================
+// 패널이 한 프레임 스캔을 끝내고 V-blank에 들어가면 TE 핀이 HIGH가 된다 (FRMCTR1 기준 70Hz).
+// SPI 쓰기(줄당 ~0.24ms)는 스캔(줄당 ~0.04ms)보다 느려서, TE에 맞춰 시작해도 V-blank 안에 끝나는 작은 영역만 찢어지지 않는다.
+static volatile uint32_t ili9341_te_frames = 0; // 지금까지 받은 TE 펄스 수
+
+/**
+  * @brief  TE 신호 초기화: TEON(V-blank만) 전송 + PA8을 EXTI8 상승 엣지 인터럽트로 설정
+  *         (AFIO 클럭은 main에서 활성화되어 있어야 함)
+  */
+void ILI9341_TE_init(void) {
+    uint8_t mode = 0x00; // TELOM=0: V-blank 정보만 출력
+
+    init_gpio(ILI9341_TE_PORT, ILI9341_TE_PIN, GPIO_MODE_INPUT_VAL, GPIO_CNF_FLOATING_IN);
+
+    AFIO->EXTICR[2] &= ~AFIO_EXTICR3_EXTI8;  // EXTI8 <- PA8
+    EXTI->RTSR |= EXTI_RTSR_TR8;             // 상승 엣지
+    EXTI->FTSR &= ~EXTI_FTSR_TR8;
+    EXTI->PR    = EXTI_PR_PR8;               // 남아 있던 펜딩 클리어
+    EXTI->IMR  |= EXTI_IMR_MR8;
+
+    NVIC_SetPriority(EXTI9_5_IRQn, 2);
+    NVIC_EnableIRQ(EXTI9_5_IRQn);
+
+    ILI9341_WriteCommandData(ILI9341_TEON, &mode, 1);
+}
+
+/**
+  * @brief  TE 펄스를 소프트웨어로 발생 (EXTI8 SWIER). TE 배선이 없을 때 테스트용.
+  *         실제 TE 엣지와 같은 인터럽트 경로를 탄다.
+  */
+void ILI9341_TE_SimulatePulse(void) {
+    EXTI->SWIER = EXTI_SWIER_SWI8;
+}
+
+/**
+  * @brief  지금까지 받은 TE 펄스(프레임) 수
+  */
+uint32_t ILI9341_TE_GetFrameCount(void) {
+    return ili9341_te_frames;
+}
+
+/**
+  * @brief  다음 V-blank 시작(TE 상승 엣지)까지 대기
+  *         렌더링을 패널 프레임 속도에 맞출 때도 사용한다.
+  *         TE 배선이 없거나 TE가 꺼져 있으면 ILI9341_TE_TIMEOUT_MS 후 포기한다.
+  * @retval 1: V-blank 시작, 0: 타임아웃 (TE 펄스 없음)
+  */
+uint8_t ILI9341_WaitForVBlank(void) {
+    uint32_t frame = ili9341_te_frames;
+    uint32_t start_ms = ms_uptime;
+    while (ili9341_te_frames == frame) {
+        if (ms_uptime - start_ms >= ILI9341_TE_TIMEOUT_MS) return 0;
+    }
+    return 1;
+}
+
+/**
+  * @brief  V-blank에 맞춰 작은 영역을 단색으로 채움 (아이콘, 상태 표시 등)
+  *         V-blank 안에 전송이 끝나는 영역(ILI9341_SYNC_MAX_PIXELS 이하)만 찢어짐 없이 갱신된다.
+  *         그보다 큰 영역은 스캔이 전송 도중에 지나가므로 TE를 기다리지 않고 바로 채운다.
+  *         이전 DMA 전송을 먼저 끝낸 뒤 TE를 기다려야 시작 시점이 V-blank에 정확히 맞는다.
+  * @param  x, y: 시작 좌표
+  * @param  w, h: 가로, 세로 길이 (화면 밖은 잘라냄)
+  * @param  color: 채울 색상 (16비트 RGB565)
+  * @retval 1: V-blank에 맞춰 채움, 0: 너무 크거나 TE가 오지 않아 동기화 없이 채움 (또는 빈 영역)
+  */
+uint8_t ILI9341_FillRectSync(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    if (x >= ili9341_width || y >= ili9341_height || w == 0 || h == 0) return 0;
+    if (x + w > ili9341_width) w = ili9341_width - x;
+    if (y + h > ili9341_height) h = ili9341_height - y;
+
+    if ((uint32_t)w * h > ILI9341_SYNC_MAX_PIXELS) {
+        ILI9341_FillRect(x, y, w, h, color);
+        return 0;
+    }
+    ILI9341_WaitDone();
+    if (!ILI9341_WaitForVBlank()) {
+        ILI9341_FillRect(x, y, w, h, color); // TE 없음: 큰 영역과 같이 동기화 없이 채움
+        return 0;
+    }
+    ILI9341_FillRect(x, y, w, h, color);
+    return 1;
+}
+
+/**
+  * @brief  EXTI9_5 인터럽트 핸들러 (TE 핀 PA8 = EXTI8)
+  */
+void EXTI9_5_IRQHandler(void) {
+    if (EXTI->PR & EXTI_PR_PR8) {
+        EXTI->PR = EXTI_PR_PR8;  // 1을 써서 클리어 (SWIER 비트도 함께 클리어됨)
+        ili9341_te_frames++;
+    }
+}
+
+// ====================================================================
+// ==== 저전력 모드 (Partial / Idle / Sleep) ==========================
+// ====================================================================
+// Sleep In 동안에도 GRAM과 레지스터(MADCTL, 스크롤, 전원 설정 등)는 유지되므로
+// Sleep Out만 보내면 초기화 시퀀스나 화면 다시 그리기 없이 그대로 복귀한다.
+/**
+  * @brief  부분 표시 영역 설정 후 Partial Mode 진입 (PTLAR + PTLON)
+  *         영역 밖은 스캔되지 않아 패널 전력이 줄어든다. 상태 표시줄만 켜 둘 때 사용.
+  * @param  start_row: 표시할 첫 행 (게이트 기준 0 ~ 319)
+  * @param  end_row: 표시할 마지막 행 (start_row보다 작으면 끝에서 처음으로 감아서 표시)
+  */
+void ILI9341_SetPartialArea(uint16_t start_row, uint16_t end_row) {
+    uint8_t params[4] = { start_row >> 8, start_row & 0xFF, end_row >> 8, end_row & 0xFF };
+
+    ILI9341_WriteCommandData(ILI9341_PTLAR, params, 4);
+    ILI9341_WriteCommandData(ILI9341_PTLON, 0, 0);
+}
+
+/**
+  * @brief  Partial Mode 해제 (NORON), 전체 화면 표시로 복귀
+  */
+void ILI9341_NormalMode(void) {
+    ILI9341_WriteCommandData(ILI9341_NORON, 0, 0);
+}
+
+/**
+  * @brief  Idle Mode 설정 (IDMON/IDMOFF). 켜면 각 색의 MSB만 사용하는 8색 표시로 전력 감소.
+  * @param  on: 1이면 Idle Mode ON, 0이면 OFF
+  */
+void ILI9341_IdleMode(uint8_t on) {
+    ILI9341_WriteCommandData(on ? ILI9341_IDMON : ILI9341_IDMOFF, 0, 0);
+}
+
+/**
+  * @brief  Sleep In/Out. GRAM과 레지스터가 유지되므로 복귀 시 다시 그릴 필요 없음.
+  *         데이터시트 제약: SLPIN/SLPOUT 사이 120ms, 명령 후 다음 명령까지 5ms.
+  * @param  on: 1이면 Sleep In, 0이면 Sleep Out
+  */
+void ILI9341_Sleep(uint8_t on) {
+    uint32_t elapsed;
+
+    if (on == ili9341_sleeping) return;
+    ILI9341_WaitDone();  // 진행 중인 DMA 픽셀 전송을 끝낸 뒤
+
+    elapsed = ms_uptime - ili9341_sleep_cmd_ms;
+    if (elapsed < 120) delay_ms(120 - elapsed);
+
+    ILI9341_WriteCommandData(on ? ILI9341_SLPIN : ILI9341_SLPOUT, 0, 0);
+    ili9341_sleep_cmd_ms = ms_uptime;
+    ili9341_sleeping = on;
+    delay_ms(5);
+}
+
+// ====================================================================
+// ==== 디스플레이 드라이버 인터페이스 (ILI9341 백엔드) ===============
+// ====================================================================
+const display_driver_t ili9341_driver = {
+    .name            = "ILI9341",
+    .linebuf_pixels  = ILI9341_LINEBUF_PIXELS,
+    .init            = ILI9341_init,
+    .width           = ILI9341_GetWidth,
+    .height          = ILI9341_GetHeight,
+    .set_rotation    = ILI9341_SetRotation,
+    .fill_rect       = ILI9341_FillRect,
+    .stream_begin    = ILI9341_StreamBegin,
+    .stream_buffer   = ILI9341_StreamBuffer,
+    .stream_submit   = ILI9341_StreamSubmit,
+    .stream_write    = ILI9341_StreamWrite,
+    .stream_end      = ILI9341_StreamEnd,
+    .read_pixels     = ILI9341_ReadPixels,
+    .set_scroll_area = ILI9341_SetScrollArea,
+    .scroll_to       = ILI9341_ScrollTo,
+    .wait_idle       = ILI9341_WaitDone,
+};
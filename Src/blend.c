@@ -0,0 +1,112 @@
+/*
+ * blend.c
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#include "blend.h"
+
+// A4 마스크 값(0~15) -> 5비트 블렌드 계수(0~32)
+static const uint8_t blend_a4_to_a5[16] = {
+    0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32
+};
+
+/**
+  * @brief  픽셀별 8비트 알파: dst = src * a + dst * (1 - a)
+  * @param  dst: 배경 라인 버퍼 (결과로 덮어씀)
+  * @param  src: 전경 픽셀
+  * @param  alpha: 픽셀별 알파 (0 ~ 255)
+  * @param  n: 픽셀 수
+  */
+void Blend_Alpha8(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t n) {
+    while (n--) {
+        uint32_t a = BLEND_A8_TO_A5(*alpha++);
+        uint32_t b = Blend_Expand(*dst);
+        *dst++ = Blend_Pack((((Blend_Expand(*src++) - b) * a) >> 5) + b);
+    }
+}
+
+/**
+  * @brief  고정 알파 (페이드 전환 등): dst = src * alpha + dst * (1 - alpha)
+  */
+void Blend_Const(uint16_t *dst, const uint16_t *src, uint8_t alpha, uint32_t n) {
+    uint32_t a = BLEND_A8_TO_A5(alpha);
+
+    if (a == 0) return;
+    if (a == 32) {
+        while (n--) *dst++ = *src++;
+        return;
+    }
+    while (n--) {
+        uint32_t b = Blend_Expand(*dst);
+        *dst++ = Blend_Pack((((Blend_Expand(*src++) - b) * a) >> 5) + b);
+    }
+}
+
+/**
+  * @brief  단색 + 고정 알파 (반투명 오버레이, 그림자)
+  *         전경 항(color * a)은 미리 계산하므로 픽셀당 곱셈은 배경 쪽 한 번뿐이다.
+  */
+void Blend_Fill(uint16_t *dst, uint16_t color, uint8_t alpha, uint32_t n) {
+    uint32_t a = BLEND_A8_TO_A5(alpha);
+    uint32_t fa = Blend_Expand(color) * a;
+    uint32_t ia = 32 - a;
+
+    while (n--) {
+        *dst = Blend_Pack((fa + Blend_Expand(*dst) * ia) >> 5);
+        dst++;
+    }
+}
+
+/**
+  * @brief  미리 곱한(premultiplied) 전경: dst = src + dst * (1 - a)
+  *         src의 RGB에 이미 알파가 곱해져 있으므로 픽셀당 곱셈은 배경 쪽 한 번뿐이다.
+  */
+void Blend_Premul(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t n) {
+    while (n--) {
+        uint32_t ia = 32 - BLEND_A8_TO_A5(*alpha++);
+        *dst = Blend_Pack(Blend_Expand(*src++) + ((Blend_Expand(*dst) * ia) >> 5));
+        dst++;
+    }
+}
+
+/**
+  * @brief  단색 + A8 커버리지 마스크 (안티앨리어싱 글리프/아이콘)
+  *         마스크 0과 255는 곱셈 없이 건너뛰거나 그대로 쓴다.
+  */
+void Blend_MaskA8(uint16_t *dst, uint16_t color, const uint8_t *mask, uint32_t n) {
+    uint32_t f = Blend_Expand(color);
+
+    while (n--) {
+        uint8_t m = *mask++;
+        if (m == 0xFF) {
+            *dst = color;
+        } else if (m) {
+            uint32_t b = Blend_Expand(*dst);
+            *dst = Blend_Pack((((f - b) * BLEND_A8_TO_A5(m)) >> 5) + b);
+        }
+        dst++;
+    }
+}
+
+/**
+  * @brief  단색 + A4 커버리지 마스크 (바이트당 2픽셀, 상위 니블이 먼저)
+  * @param  mask: 마스크 한 줄의 시작
+  * @param  first: dst[0]에 대응하는 마스크 픽셀 번호 (클리핑/라인 버퍼 분할로 홀수일 수 있음)
+  */
+void Blend_MaskA4(uint16_t *dst, uint16_t color, const uint8_t *mask, uint32_t first, uint32_t n) {
+    uint32_t f = Blend_Expand(color);
+    uint32_t i;
+
+    for (i = first; i < first + n; i++) {
+        uint8_t m = (i & 1) ? (mask[i >> 1] & 0x0F) : (mask[i >> 1] >> 4);
+        if (m == 0x0F) {
+            *dst = color;
+        } else if (m) {
+            uint32_t b = Blend_Expand(*dst);
+            *dst = Blend_Pack((((f - b) * blend_a4_to_a5[m]) >> 5) + b);
+        }
+        dst++;
+    }
+}
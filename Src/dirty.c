@@ -0,0 +1,178 @@
+/*
+ * dirty.c
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#include "dirty.h"
+
+static dirty_rect_t dirty_rects[DIRTY_MAX_RECTS];
+static uint8_t  dirty_count = 0;
+static uint16_t dirty_adds = 0;
+static uint16_t dirty_width = 0, dirty_height = 0;
+static uint32_t dirty_window_cost = DIRTY_WINDOW_COST;
+static dirty_stats_t dirty_stats;
+
+static uint32_t Dirty_Area(const dirty_rect_t *r) {
+    return (uint32_t)r->w * r->h;
+}
+
+// a와 b를 모두 덮는 외곽 사각형
+static void Dirty_Bounds(const dirty_rect_t *a, const dirty_rect_t *b, dirty_rect_t *out) {
+    int16_t x0 = a->x < b->x ? a->x : b->x;
+    int16_t y0 = a->y < b->y ? a->y : b->y;
+    int16_t x1 = (a->x + a->w > b->x + b->w) ? a->x + a->w : b->x + b->w;
+    int16_t y1 = (a->y + a->h > b->y + b->h) ? a->y + a->h : b->y + b->h;
+
+    out->x = x0;
+    out->y = y0;
+    out->w = x1 - x0;
+    out->h = y1 - y0;
+}
+
+/**
+  * @brief  a와 b를 합쳤을 때 늘어나는 비용 (음수면 합치는 편이 이득)
+  *         따로: A + B + 창 2개, 합침: 외곽 면적 + 창 1개
+  */
+static int32_t Dirty_MergeCost(const dirty_rect_t *a, const dirty_rect_t *b) {
+    dirty_rect_t u;
+
+    Dirty_Bounds(a, b, &u);
+    return (int32_t)(Dirty_Area(&u) - Dirty_Area(a) - Dirty_Area(b)) - (int32_t)dirty_window_cost;
+}
+
+static void Dirty_Remove(uint8_t i) {
+    dirty_rects[i] = dirty_rects[--dirty_count];
+}
+
+/**
+  * @brief  화면 크기 설정 후 추적 상태와 통계 초기화 (화면 회전 후에도 다시 호출)
+  * @param  width, height: 화면 크기 (GFX_GetWidth/GFX_GetHeight)
+  */
+void Dirty_Init(uint16_t width, uint16_t height) {
+    dirty_width = width;
+    dirty_height = height;
+    dirty_count = 0;
+    dirty_adds = 0;
+    Dirty_ResetStats();
+}
+
+/**
+  * @brief  창 하나의 고정 비용 변경 (픽셀 환산). 클수록 더 적극적으로 합친다.
+  *         SPI 16MHz 기준 창 설정만 약 6픽셀이고, 호출/DMA 설정까지 포함하면 수십 픽셀이 된다.
+  */
+void Dirty_SetWindowCost(uint32_t cost) {
+    dirty_window_cost = cost;
+}
+
+/**
+  * @brief  변경 영역 추가. 합치는 편이 싼 기존 사각형이 있으면 합치고,
+  *         커진 사각형이 다른 것과 또 합쳐질 수 있으므로 더 이상 없을 때까지 반복한다.
+  * @param  x, y, w, h: 화면 좌표 사각형 (화면 밖은 잘라냄)
+  */
+void Dirty_Add(int16_t x, int16_t y, int16_t w, int16_t h) {
+    dirty_rect_t r;
+    int32_t x1 = x + w, y1 = y + h;
+    uint8_t i, merged;
+
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 > dirty_width) x1 = dirty_width;
+    if (y1 > dirty_height) y1 = dirty_height;
+    if (x >= x1 || y >= y1) return;
+
+    r.x = x;
+    r.y = y;
+    r.w = x1 - x;
+    r.h = y1 - y;
+    dirty_adds++;
+
+    do {
+        merged = 0;
+        for (i = 0; i < dirty_count; i++) {
+            if (Dirty_MergeCost(&dirty_rects[i], &r) <= 0) {
+                Dirty_Bounds(&dirty_rects[i], &r, &r);
+                Dirty_Remove(i);
+                merged = 1;
+                break;
+            }
+        }
+    } while (merged);
+
+    if (dirty_count == DIRTY_MAX_RECTS) {
+        // 자리가 없으면 새 사각형과 가장 싸게 합쳐지는 기존 사각형을 합침
+        int32_t best_cost = 0x7FFFFFFF;
+        uint8_t best = 0;
+
+        for (i = 0; i < dirty_count; i++) {
+            int32_t c = Dirty_MergeCost(&dirty_rects[i], &r);
+            if (c < best_cost) {
+                best_cost = c;
+                best = i;
+            }
+        }
+        Dirty_Bounds(&dirty_rects[best], &r, &r);
+        Dirty_Remove(best);
+    }
+    dirty_rects[dirty_count++] = r;
+}
+
+/**
+  * @brief  화면 전체를 변경 영역으로 (화면 지우기, 회전 후 등)
+  */
+void Dirty_AddAll(void) {
+    dirty_count = 0;
+    Dirty_Add(0, 0, dirty_width, dirty_height);
+}
+
+/**
+  * @brief  이번 프레임에 다시 그릴 영역이 없는지 확인
+  * @retval 1: 없음, 0: 있음
+  */
+uint8_t Dirty_IsEmpty(void) {
+    return dirty_count == 0;
+}
+
+/**
+  * @brief  프레임 종료: 다시 그릴 창 목록을 꺼내고 추적 상태를 비움. 통계를 갱신한다.
+  *         돌려준 창은 서로 겹칠 수 있다 (겹친 채로 두는 편이 비용 모델상 더 싼 경우).
+  * @param  out: DIRTY_MAX_RECTS 개 이상의 배열
+  * @retval 창 수
+  */
+uint8_t Dirty_Take(dirty_rect_t *out) {
+    uint8_t i, n = dirty_count;
+    uint32_t pixels = 0;
+
+    for (i = 0; i < n; i++) {
+        out[i] = dirty_rects[i];
+        pixels += Dirty_Area(&dirty_rects[i]);
+    }
+
+    dirty_stats.frames++;
+    dirty_stats.last_adds = dirty_adds;
+    dirty_stats.last_windows = n;
+    dirty_stats.last_pixels = pixels;
+    dirty_stats.total_pixels += pixels;
+    dirty_stats.total_windows += n;
+
+    dirty_count = 0;
+    dirty_adds = 0;
+    return n;
+}
+
+/**
+  * @brief  프레임 통계 읽기. 절약량은 screen_pixels * frames 대비 total_pixels로 본다.
+  */
+void Dirty_GetStats(dirty_stats_t *stats) {
+    *stats = dirty_stats;
+    stats->screen_pixels = (uint32_t)dirty_width * dirty_height;
+}
+
+/**
+  * @brief  누적 통계 초기화
+  */
+void Dirty_ResetStats(void) {
+    dirty_stats_t zero = { 0 };
+    dirty_stats = zero;
+}
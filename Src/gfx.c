@@ -0,0 +1,1566 @@
+/*
+ * gfx.c
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#include "gfx.h"
+#include "5x5font.h"
+#include "blend.h"
+
+static const display_driver_t *gfx_drv;  // 현재 사용 중인 패널 드라이버
+static uint16_t gfx_width;               // 현재 회전 방향 기준 화면 크기 (프리미티브마다 간접 호출하지 않도록 캐시)
+static uint16_t gfx_height;
+
+// 클립/뷰포트 상태: 원점과 클립 사각형 모두 화면 좌표 (끝 좌표는 포함하지 않음)
+typedef struct {
+    int16_t ox, oy;          // 로컬 (0, 0)의 화면 좌표
+    int16_t x0, y0, x1, y1;  // 그릴 수 있는 영역
+    int16_t ex, ey;          // 뷰포트 오른쪽/아래 끝 (줄 바꿈 기준, GFX_PushClip으로는 바뀌지 않음)
+} gfx_clip_t;
+
+static gfx_clip_t gfx_clip;                          // 현재 상태
+static gfx_clip_t gfx_clip_stack[GFX_CLIP_DEPTH];    // Push 전 상태
+static uint8_t gfx_clip_depth;
+
+// ====================================================================
+// ==== 드라이버 연결 / 화면 정보 =====================================
+// ====================================================================
+/**
+  * @brief  드라이버를 연결하고 패널 초기화 시퀀스 실행
+  *         버스(SPI, GPIO 등) 초기화는 이 함수를 부르기 전에 끝나 있어야 한다.
+  * @param  drv: 패널 드라이버 (예: &ili9341_driver)
+  */
+void GFX_init(const display_driver_t *drv) {
+    gfx_drv = drv;
+    gfx_drv->init();
+    gfx_width = gfx_drv->width();
+    gfx_height = gfx_drv->height();
+    GFX_ResetClip();
+}
+
+const display_driver_t *GFX_GetDriver(void) {
+    return gfx_drv;
+}
+
+/**
+  * @brief  초기화 없이 그리기 대상 드라이버만 바꿈 (스트립 렌더러 같은 RAM 대상 전환용). 클립 스택은 비운다.
+  */
+void GFX_SetDriver(const display_driver_t *drv) {
+    gfx_drv = drv;
+    gfx_width = gfx_drv->width();
+    gfx_height = gfx_drv->height();
+    GFX_ResetClip();
+}
+
+/**
+  * @brief  화면 회전 (0 ~ 3, 90도 단위) 후 논리 크기 갱신. 클립 스택은 비운다.
+  */
+void GFX_SetRotation(uint8_t rotation) {
+    gfx_drv->set_rotation(rotation);
+    gfx_width = gfx_drv->width();
+    gfx_height = gfx_drv->height();
+    GFX_ResetClip();
+}
+
+uint16_t GFX_GetWidth(void) {
+    return gfx_width;
+}
+
+uint16_t GFX_GetHeight(void) {
+    return gfx_height;
+}
+
+/**
+  * @brief  진행 중인 비동기 전송이 끝날 때까지 대기
+  */
+void GFX_WaitDone(void) {
+    gfx_drv->wait_idle();
+}
+
+// ====================================================================
+// ==== 클립 / 뷰포트 스택 ============================================
+// ====================================================================
+// 프리미티브 좌표는 모두 현재 뷰포트 기준 로컬 좌표다. 화면 좌표 변환과 클리핑은
+// 프리미티브(또는 span/run)마다 한 번, 주소 창을 잡기 전에 GFX_ClipRect에서 끝낸다.
+// 클립 영역 밖의 작업은 버스를 건드리지 않고 버려진다.
+
+/**
+  * @brief  클립 스택을 비우고 화면 전체를 클립 영역으로 (원점 0, 0)
+  */
+void GFX_ResetClip(void) {
+    gfx_clip.ox = 0;
+    gfx_clip.oy = 0;
+    gfx_clip.x0 = 0;
+    gfx_clip.y0 = 0;
+    gfx_clip.x1 = gfx_width;
+    gfx_clip.y1 = gfx_height;
+    gfx_clip.ex = gfx_width;
+    gfx_clip.ey = gfx_height;
+    gfx_clip_depth = 0;
+}
+
+// 현재 상태를 저장하고, 로컬 사각형과 현재 클립 영역의 교집합을 새 클립 영역으로
+static uint8_t GFX_ClipPush(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t move_origin) {
+    int32_t x0 = gfx_clip.ox + x, y0 = gfx_clip.oy + y;
+    int32_t x1 = x0 + (w > 0 ? w : 0), y1 = y0 + (h > 0 ? h : 0);
+
+    if (gfx_clip_depth >= GFX_CLIP_DEPTH) return 0;
+    gfx_clip_stack[gfx_clip_depth++] = gfx_clip;
+
+    if (move_origin) {
+        gfx_clip.ox = x0;
+        gfx_clip.oy = y0;
+        gfx_clip.ex = x1;
+        gfx_clip.ey = y1;
+    }
+    if (x0 < gfx_clip.x0) x0 = gfx_clip.x0;
+    if (y0 < gfx_clip.y0) y0 = gfx_clip.y0;
+    if (x1 > gfx_clip.x1) x1 = gfx_clip.x1;
+    if (y1 > gfx_clip.y1) y1 = gfx_clip.y1;
+    if (x1 < x0) x1 = x0;     // 교집합이 없으면 빈 영역 (모든 그리기가 버려짐)
+    if (y1 < y0) y1 = y0;
+    gfx_clip.x0 = x0;
+    gfx_clip.y0 = y0;
+    gfx_clip.x1 = x1;
+    gfx_clip.y1 = y1;
+    return 1;
+}
+
+/**
+  * @brief  뷰포트 진입: 로컬 원점을 (x, y)로 옮기고 w x h 밖은 잘라냄 (위젯 그리기용)
+  * @param  x, y, w, h: 현재 로컬 좌표 기준 영역 (바깥 클립 영역과의 교집합만 남음)
+  * @retval 1: 성공, 0: 스택이 가득 참 (상태 변화 없음, GFX_PopClip을 부르지 말 것)
+  */
+uint8_t GFX_PushViewport(int16_t x, int16_t y, int16_t w, int16_t h) {
+    return GFX_ClipPush(x, y, w, h, 1);
+}
+
+/**
+  * @brief  원점은 그대로 두고 클립 영역만 좁힘 (가려진 부분 제외 등)
+  * @retval 1: 성공, 0: 스택이 가득 참 (상태 변화 없음, GFX_PopClip을 부르지 말 것)
+  */
+uint8_t GFX_PushClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+    return GFX_ClipPush(x, y, w, h, 0);
+}
+
+/**
+  * @brief  직전 GFX_PushViewport / GFX_PushClip 이전 상태로 복귀
+  */
+void GFX_PopClip(void) {
+    if (gfx_clip_depth) gfx_clip = gfx_clip_stack[--gfx_clip_depth];
+}
+
+// 로컬 외곽 사각형이 클립 영역과 겹치는지 (프리미티브가 래스터화 전에 통째로 버릴 때 사용)
+static uint8_t GFX_Visible(int32_t x, int32_t y, int32_t w, int32_t h) {
+    x += gfx_clip.ox;
+    y += gfx_clip.oy;
+    return w > 0 && h > 0 && x < gfx_clip.x1 && y < gfx_clip.y1 &&
+           x + w > gfx_clip.x0 && y + h > gfx_clip.y0;
+}
+
+/**
+  * @brief  로컬 사각형이 클립 영역과 겹치는지 확인 (위젯이 그리기 전에 통째로 건너뛸 때 사용)
+  * @retval 1: 일부라도 보임, 0: 완전히 가려짐
+  */
+uint8_t GFX_IsVisible(int16_t x, int16_t y, int16_t w, int16_t h) {
+    return GFX_Visible(x, y, w, h);
+}
+
+/**
+  * @brief  로컬 사각형을 화면 좌표로 옮기고 클립 영역에 맞게 자름 (끝 좌표는 포함하지 않음)
+  * @retval 1: 남는 영역 있음, 0: 전부 잘림
+  */
+static uint8_t GFX_ClipRect(int32_t x, int32_t y, int32_t w, int32_t h,
+                            int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1) {
+    x += gfx_clip.ox;
+    y += gfx_clip.oy;
+    *x0 = x < gfx_clip.x0 ? gfx_clip.x0 : x;
+    *y0 = y < gfx_clip.y0 ? gfx_clip.y0 : y;
+    *x1 = x + w > gfx_clip.x1 ? gfx_clip.x1 : x + w;
+    *y1 = y + h > gfx_clip.y1 ? gfx_clip.y1 : y + h;
+    return *x0 < *x1 && *y0 < *y1;
+}
+
+// ====================================================================
+// ==== 기본 프리미티브 ===============================================
+// ====================================================================
+/**
+  * @brief  로컬 좌표의 단색 직사각형을 클립 영역에 맞게 잘라서 드라이버로 전송
+  *         선/도형 프리미티브는 모두 이 함수로 run(span)을 내보내므로 클리핑 규칙이 한 곳에 모인다.
+  */
+static void GFX_FillClipped(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    int32_t x0, y0, x1, y1;
+
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+    gfx_drv->fill_rect(x0, y0, x1 - x0, y1 - y0, color);
+}
+
+/**
+  * @brief  클립 영역 전체를 단색으로 채움 (비블로킹, 클립이 없으면 화면 전체)
+  * @param  color: 채울 색상 (16비트 RGB565)
+  */
+void GFX_FillScreen(uint16_t color) {
+    if (gfx_clip.x0 >= gfx_clip.x1 || gfx_clip.y0 >= gfx_clip.y1) return;
+    gfx_drv->fill_rect(gfx_clip.x0, gfx_clip.y0, gfx_clip.x1 - gfx_clip.x0, gfx_clip.y1 - gfx_clip.y0, color);
+}
+
+/**
+  * @brief  단일 픽셀을 그림
+  * @param  x, y: 픽셀 좌표
+  * @param  color: 픽셀 색상 (16비트 RGB565)
+  */
+void GFX_DrawPixel(int16_t x, int16_t y, uint16_t color) {
+    // 클립 영역 밖이면 그리지 않음
+    x += gfx_clip.ox;
+    y += gfx_clip.oy;
+    if (x < gfx_clip.x0 || y < gfx_clip.y0 || x >= gfx_clip.x1 || y >= gfx_clip.y1) return;
+
+    gfx_drv->stream_begin(x, y, x, y); // 단일 픽셀 영역 설정 (CS 한 번)
+    gfx_drv->stream_buffer()[0] = color;
+    gfx_drv->stream_submit(1);
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  직사각형을 그림 (비블로킹)
+  * @param  x, y: 시작 좌표
+  * @param  w, h: 가로, 세로 길이
+  * @param  color: 색상 (16비트 RGB565)
+  */
+void GFX_DrawRectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    GFX_FillClipped(x, y, w, h, color);
+}
+
+/**
+  * @brief  화면에 이미지를 그림
+  *         바이트 배열을 RGB565 워드로 바꾸는 작업(CPU)과 전송(DMA)을 라인 버퍼로 겹쳐서 처리.
+  * @param  x: 이미지를 그릴 시작 X 좌표
+  * @param  y: 이미지를 그릴 시작 Y 좌표
+  * @param  w: 이미지의 가로 길이 (픽셀)
+  * @param  h: 이미지의 세로 길이 (픽셀)
+  * @param  image_data: RGB565 형식의 픽셀 데이터 배열 포인터 (High Byte 먼저)
+  */
+void GFX_DrawImage(int16_t x, int16_t y, uint16_t w, uint16_t h, const char *image_data) {
+    const uint8_t *row_data = (const uint8_t *)image_data; // 현재 줄의 픽셀 데이터 포인터
+    uint16_t stride = w;  // 원본 이미지 한 줄의 픽셀 수 (클리핑 전)
+    uint16_t linebuf = gfx_drv->linebuf_pixels;
+    uint16_t row, col, n;
+    int32_t x0, y0, x1, y1;
+
+    // 이미지가 클립 영역을 벗어나지 않도록 클리핑 (왼쪽/위가 잘리면 원본 시작 위치를 옮김)
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+    row_data += ((uint32_t)(y0 - y - gfx_clip.oy) * stride + (x0 - x - gfx_clip.ox)) * 2;
+    w = x1 - x0;
+    h = y1 - y0;
+
+    // 이미지가 그려질 영역 설정
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+
+    for (row = 0; row < h; row++) {
+        const uint8_t *p = row_data;
+        // 한 줄이 버퍼보다 길면 버퍼 크기만큼 나눠서 전송
+        for (col = 0; col < w; col += n) {
+            uint16_t *buf = gfx_drv->stream_buffer();
+            uint16_t i;
+            n = w - col;
+            if (n > linebuf) n = linebuf;
+            for (i = 0; i < n; i++) {
+                buf[i] = ((uint16_t)p[0] << 8) | p[1]; // High Byte, Low Byte -> RGB565 워드
+                p += 2;
+            }
+            gfx_drv->stream_submit(n);
+        }
+        row_data += (uint32_t)stride * 2;
+    }
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  uint16_t RGB565 버퍼를 화면에 그림 (변환이 필요 없으므로 원본을 복사 없이 전송)
+  * @param  x, y: 이미지를 그릴 시작 좌표
+  * @param  w, h: 이미지의 가로, 세로 길이 (픽셀)
+  * @param  image_data: RGB565 픽셀 배열 (예: main.c의 small_test_image)
+  */
+void GFX_DrawImage16(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint16_t *image_data) {
+    uint16_t stride = w;  // 원본 이미지 한 줄의 픽셀 수 (클리핑 전)
+    uint16_t row;
+    int32_t x0, y0, x1, y1;
+
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+    image_data += (uint32_t)(y0 - y - gfx_clip.oy) * stride + (x0 - x - gfx_clip.ox);
+    w = x1 - x0;
+    h = y1 - y0;
+
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+    if (w == stride) {
+        gfx_drv->stream_write(image_data, (uint32_t)w * h); // 클리핑이 없으면 한 번에 전송
+    } else {
+        for (row = 0; row < h; row++) {
+            gfx_drv->stream_write(image_data, w);
+            image_data += stride;
+        }
+    }
+    gfx_drv->stream_end();
+}
+
+// ====================================================================
+// ==== 텍스트 (5x5 폰트) =============================================
+// ====================================================================
+/**
+  * @brief  문자 하나를 그림 (scale 배 확대, 배경색 포함)
+  *         글자 영역을 한 번에 설정하고, 글리프를 한 줄씩 라인 버퍼에 펼치는 동안 DMA가 이전 버퍼를 전송.
+  */
+void GFX_DrawChar(char c, int16_t x, int16_t y, uint16_t color, uint16_t bg_color, uint8_t scale) {
+    if (c < 32 || c > 32 + 95) {
+        return;
+    }
+
+    int char_index = c - 32;
+    uint16_t linebuf = gfx_drv->linebuf_pixels;
+    uint16_t *buf;
+    uint16_t n = 0;                        // 현재 라인 버퍼에 채운 픽셀 수
+    int32_t x0, y0, x1, y1;
+    uint16_t px0, py0, w;                  // 글자 안에서 보이는 부분의 시작 위치와 너비
+
+    if (scale == 0) return;
+    if (!GFX_ClipRect(x, y, FONT_CHAR_WIDTH * scale, FONT_CHAR_HEIGHT * scale, &x0, &y0, &x1, &y1)) return;
+    px0 = x0 - x - gfx_clip.ox;
+    py0 = y0 - y - gfx_clip.oy;
+    w = x1 - x0;
+
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+    buf = gfx_drv->stream_buffer();
+
+    for (uint16_t py = py0; py < py0 + (y1 - y0); py++) {
+        int row = py / scale;
+
+        if (n + w > linebuf) { // 다음 줄이 안 들어가면 지금까지 채운 버퍼를 전송
+            gfx_drv->stream_submit(n);
+            buf = gfx_drv->stream_buffer();
+            n = 0;
+        }
+        for (uint16_t px = px0; px < px0 + w; px++) {
+            // (row + FONT_BIT_OFFSET)으로 비트를 정확한 위치에서 읽는다.
+            buf[n++] = ((font[char_index][px / scale] >> (row + 2)) & 0x01) ? color : bg_color;
+        }
+    }
+    if (n) gfx_drv->stream_submit(n);
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  문자열을 그림 (뷰포트 너비를 넘으면 시작 X로 줄 바꿈)
+  */
+void GFX_DrawString(const char *str, int16_t x, int16_t y, uint16_t color, uint16_t bg_color, uint8_t scale) {
+    int16_t current_x = x;
+    int16_t right = gfx_clip.ex - gfx_clip.ox;    // 뷰포트의 로컬 오른쪽/아래 끝
+    int16_t bottom = gfx_clip.ey - gfx_clip.oy;
+
+    // 확대된 글자 하나의 너비 (폰트 너비 * 스케일) + 1 픽셀 여백
+    const int char_rendered_width = (FONT_CHAR_WIDTH * scale) + 1;
+    const int char_rendered_height = (FONT_CHAR_HEIGHT * scale) + 2; // 폰트 높이 * 스케일 + 줄 간 여백
+
+    while (*str) {
+        GFX_DrawChar(*str, current_x, y, color, bg_color, scale);
+        current_x += char_rendered_width; // 다음 문자의 X 좌표
+
+        // 뷰포트 너비 초과 시 줄 바꿈 (뷰포트가 없으면 현재 회전 방향 기준 화면 너비)
+        // GFX_PushClip으로 일부만 다시 그릴 때도 글자 배치가 바뀌지 않도록 클립 영역이 아닌 뷰포트 기준
+        if (current_x + char_rendered_width >= right) {
+            current_x = x; // 시작 X 위치로 리셋
+            y += char_rendered_height; // 다음 줄의 Y 좌표
+            // 뷰포트 높이 초과 시 중단
+            if (y >= bottom) break;
+        }
+        str++;
+    }
+}
+
+// ====================================================================
+// ==== 선 / span 프리미티브 ==========================================
+// ====================================================================
+// 좌표는 부호 있는 값이라 화면 밖에서 시작하는 선/도형도 그릴 수 있다 (잘린 부분만 전송).
+// 한 run = 주소 창 설정 1번 + 픽셀 스트림 1번. 픽셀마다 창을 다시 잡지 않는다.
+
+/**
+  * @brief  가로 run 하나를 그림 (x, y에서 오른쪽으로 len 픽셀)
+  * @param  x, y: 시작 좌표
+  * @param  len: 픽셀 수 (0 이하면 무시)
+  * @param  color: 색상 (16비트 RGB565)
+  */
+void GFX_DrawSpan(int16_t x, int16_t y, int16_t len, uint16_t color) {
+    GFX_FillClipped(x, y, len, 1, color);
+}
+
+/**
+  * @brief  수평선 (GFX_DrawSpan과 같음, 축 이름을 맞춘 별칭)
+  */
+void GFX_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    GFX_FillClipped(x, y, w, 1, color);
+}
+
+/**
+  * @brief  수직선 (x, y에서 아래로 h 픽셀). 세로 1열 창에 h 픽셀을 한 번에 전송.
+  */
+void GFX_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    GFX_FillClipped(x, y, 1, h, color);
+}
+
+/**
+  * @brief  직사각형 테두리 (1픽셀 두께, 선 4개)
+  */
+void GFX_DrawFrame(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    GFX_DrawHLine(x, y, w, color);
+    if (h > 1) GFX_DrawHLine(x, y + h - 1, w, color);
+    if (h > 2) {
+        GFX_DrawVLine(x, y + 1, h - 2, color);
+        if (w > 1) GFX_DrawVLine(x + w - 1, y + 1, h - 2, color);
+    }
+}
+
+/**
+  * @brief  임의 방향 직선 (Bresenham, 양 끝점 포함)
+  *         주축 방향으로 같은 부축 좌표가 이어지는 픽셀을 run 하나로 묶어서 보낸다.
+  *         완만한 선은 수평 run, 가파른 선은 수직 run이 되고, 45도 선은 1픽셀 run이 된다.
+  */
+void GFX_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    int32_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int32_t dy = y1 > y0 ? y1 - y0 : y0 - y1;
+    int16_t sx = x0 < x1 ? 1 : -1;
+    int16_t sy = y0 < y1 ? 1 : -1;
+    int32_t err;
+    int16_t start;
+
+    if (!GFX_Visible(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, dx + 1, dy + 1)) return;
+
+    if (dx >= dy) {
+        // 완만한 선: x를 한 칸씩 진행하고, y가 바뀌기 직전까지를 수평 run으로 묶음
+        err = dx / 2;
+        start = x0;
+        for (;;) {
+            if (x0 == x1) {
+                GFX_DrawHLine(sx > 0 ? start : x0, y0, (sx > 0 ? x0 - start : start - x0) + 1, color);
+                break;
+            }
+            err -= dy;
+            if (err < 0) {
+                GFX_DrawHLine(sx > 0 ? start : x0, y0, (sx > 0 ? x0 - start : start - x0) + 1, color);
+                y0 += sy;
+                err += dx;
+                x0 += sx;
+                start = x0;
+            } else {
+                x0 += sx;
+            }
+        }
+    } else {
+        // 가파른 선: y를 한 칸씩 진행하고, x가 바뀌기 직전까지를 수직 run으로 묶음
+        err = dy / 2;
+        start = y0;
+        for (;;) {
+            if (y0 == y1) {
+                GFX_DrawVLine(x0, sy > 0 ? start : y0, (sy > 0 ? y0 - start : start - y0) + 1, color);
+                break;
+            }
+            err -= dx;
+            if (err < 0) {
+                GFX_DrawVLine(x0, sy > 0 ? start : y0, (sy > 0 ? y0 - start : start - y0) + 1, color);
+                x0 += sx;
+                err += dy;
+                y0 += sy;
+                start = y0;
+            } else {
+                y0 += sy;
+            }
+        }
+    }
+}
+
+// ====================================================================
+// ==== 원 / 타원 / 호 (span 래스터라이저) ============================
+// ====================================================================
+// 정수 연산만 사용한다 (Cortex-M3에는 FPU가 없음).
+// 한 행의 반폭 hw(dy)는 중점 판정 4x²(2ry+1)² + 4dy²(2rx+1)² <= (2rx+1)²(2ry+1)² 을 만족하는 최대 x.
+// 원(rx = ry = r)에서는 x² + dy² <= r² + r, 즉 중점 원 알고리즘과 같은 픽셀이 된다.
+// 채우기는 행마다 span 하나, 테두리는 행마다 좌우 run을 내고 옆면의 1픽셀 run은 세로로 합친다.
+
+// sin(0 ~ 90도), Q14 (16384 = 1.0)
+static const int16_t gfx_sin_q14[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+/**
+  * @brief  정수 각도의 sin 값 (Q14, 16384 = 1.0)
+  * @param  deg: 각도 (도 단위, 음수/360 이상 허용)
+  */
+int16_t GFX_Sin(int16_t deg) {
+    int16_t d = deg % 360;
+    if (d < 0) d += 360;
+    if (d <= 90)  return gfx_sin_q14[d];
+    if (d <= 180) return gfx_sin_q14[180 - d];
+    if (d <= 270) return -gfx_sin_q14[d - 180];
+    return -gfx_sin_q14[360 - d];
+}
+
+/**
+  * @brief  정수 각도의 cos 값 (Q14)
+  */
+int16_t GFX_Cos(int16_t deg) {
+    return GFX_Sin(deg + 90);
+}
+
+// 타원 행 반폭 계산기 (dy를 0부터 차례로 늘려 가며 호출, x는 줄어들기만 하므로 전체 O(rx + ry))
+typedef struct {
+    int64_t kx;    // 4(2ry+1)²
+    int64_t ky;    // 4(2rx+1)²
+    int64_t lim;   // (2rx+1)²(2ry+1)²
+    int16_t x;
+} gfx_ellipse_t;
+
+static void GFX_EllipseBegin(gfx_ellipse_t *e, int16_t rx, int16_t ry) {
+    int64_t ax = 2 * rx + 1, ay = 2 * ry + 1;
+    e->kx = 4 * ay * ay;
+    e->ky = 4 * ax * ax;
+    e->lim = ax * ax * ay * ay;
+    e->x = rx;
+}
+
+// 행 dy의 반폭. 행이 타원 밖이면 -1
+static int16_t GFX_EllipseRow(gfx_ellipse_t *e, int16_t dy) {
+    int64_t yy = e->ky * dy * dy;
+    while (e->x >= 0 && e->kx * e->x * e->x + yy > e->lim) e->x--;
+    return e->x;
+}
+
+// 호의 각도 범위. 180도 이하 조각 최대 2개로 나누고, 각 조각은 시작/끝 방향 벡터(Q14)로 표현.
+// 화면 좌표(y 아래쪽)에서 0도 = 3시 방향, 각도는 시계 방향으로 증가.
+typedef struct {
+    uint8_t n;
+    int32_t sx[2], sy[2], ex[2], ey[2];
+} gfx_sector_t;
+
+static void GFX_SectorInit(gfx_sector_t *s, int16_t start_deg, int16_t end_deg) {
+    int16_t span = end_deg - start_deg;
+    uint8_t i;
+
+    while (span < 0) span += 360;
+    if (span == 0 || span > 360) span = 360;   // 시작 = 끝이면 한 바퀴
+    s->n = (span > 180) ? 2 : 1;
+    for (i = 0; i < s->n; i++) {
+        int16_t a0 = start_deg + i * 180;
+        int16_t a1 = (i + 1 < s->n) ? a0 + 180 : start_deg + span;
+        s->sx[i] = GFX_Cos(a0); s->sy[i] = GFX_Sin(a0);
+        s->ex[i] = GFX_Cos(a1); s->ey[i] = GFX_Sin(a1);
+    }
+}
+
+// 정수 나눗셈 내림/올림 (음수 포함)
+static int32_t GFX_DivFloor(int32_t n, int32_t d) {
+    int32_t q = n / d;
+    if ((n % d) && ((n < 0) != (d < 0))) q--;
+    return q;
+}
+static int32_t GFX_DivCeil(int32_t n, int32_t d) {
+    int32_t q = n / d;
+    if ((n % d) && ((n < 0) == (d < 0))) q++;
+    return q;
+}
+
+// c·x <= d 조건으로 [*lo, *hi] 구간을 좁힘
+static void GFX_Constrain(int32_t c, int32_t d, int32_t *lo, int32_t *hi) {
+    if (c > 0) {
+        int32_t m = GFX_DivFloor(d, c);
+        if (m < *hi) *hi = m;
+    } else if (c < 0) {
+        int32_t m = GFX_DivCeil(d, c);
+        if (m > *lo) *lo = m;
+    } else if (d < 0) {
+        *lo = 1; *hi = 0;      // x와 무관하게 불만족
+    }
+}
+
+/**
+  * @brief  중심 기준 행 y의 구간 [x0, x1] 중 호 범위에 들어가는 부분을 span으로 출력
+  *         조각 P 안의 점: cross(S, P) >= 0 이고 cross(P, E) >= 0 (x에 대한 1차 부등식 2개)
+  */
+static void GFX_SectorSpan(const gfx_sector_t *s, int16_t cx, int16_t cy, int16_t y,
+                           int32_t x0, int32_t x1, uint16_t color) {
+    int32_t lo[2], hi[2];
+    uint8_t i, n = 0;
+
+    for (i = 0; i < s->n; i++) {
+        lo[n] = x0; hi[n] = x1;
+        GFX_Constrain(s->sy[i], s->sx[i] * y, &lo[n], &hi[n]);     // Sx·y - Sy·x >= 0
+        GFX_Constrain(-s->ey[i], -s->ex[i] * y, &lo[n], &hi[n]);   // x·Ey - y·Ex >= 0
+        if (lo[n] <= hi[n]) n++;
+    }
+    // 두 조각이 맞닿으면 span 하나로 합침
+    if (n == 2 && lo[1] <= hi[0] + 1 && lo[0] <= hi[1] + 1) {
+        if (lo[1] < lo[0]) lo[0] = lo[1];
+        if (hi[1] > hi[0]) hi[0] = hi[1];
+        n = 1;
+    }
+    for (i = 0; i < n; i++) {
+        GFX_FillClipped(cx + lo[i], cy + y, hi[i] - lo[i] + 1, 1, color);
+    }
+}
+
+// 테두리 한 행(dy)의 run 출력: 오른쪽 [a, b], 왼쪽 [-b, -a] (a = 0이면 하나로 합침)
+static void GFX_OutlineRow(int16_t cx, int16_t cy, int16_t dy, int16_t a, int16_t b,
+                           const gfx_sector_t *sec, uint16_t color) {
+    int16_t y = dy;
+    uint8_t k;
+
+    for (k = 0; k < (dy ? 2 : 1); k++, y = -dy) {
+        if (sec) {
+            if (a == 0) {
+                GFX_SectorSpan(sec, cx, cy, y, -b, b, color);
+            } else {
+                GFX_SectorSpan(sec, cx, cy, y, a, b, color);
+                GFX_SectorSpan(sec, cx, cy, y, -b, -a, color);
+            }
+        } else if (a == 0) {
+            GFX_FillClipped(cx - b, cy + y, 2 * b + 1, 1, color);
+        } else {
+            GFX_FillClipped(cx + a, cy + y, b - a + 1, 1, color);
+            GFX_FillClipped(cx - b, cy + y, b - a + 1, 1, color);
+        }
+    }
+}
+
+// 옆면에서 모은 세로 run 출력: x = ±b, dy = d0 ~ d1 (위/아래 대칭)
+static void GFX_OutlineColumn(int16_t cx, int16_t cy, int16_t b, int16_t d0, int16_t d1, uint16_t color) {
+    if (d0 == 0) {
+        GFX_FillClipped(cx + b, cy - d1, 1, 2 * d1 + 1, color);
+        GFX_FillClipped(cx - b, cy - d1, 1, 2 * d1 + 1, color);
+    } else {
+        GFX_FillClipped(cx + b, cy + d0, 1, d1 - d0 + 1, color);
+        GFX_FillClipped(cx + b, cy - d1, 1, d1 - d0 + 1, color);
+        GFX_FillClipped(cx - b, cy + d0, 1, d1 - d0 + 1, color);
+        GFX_FillClipped(cx - b, cy - d1, 1, d1 - d0 + 1, color);
+    }
+}
+
+/**
+  * @brief  타원 테두리 (sec가 NULL이 아니면 그 각도 범위만)
+  *         행 dy의 run은 [hw(dy+1) + 1, hw(dy)] 이고, 비어 있으면 hw(dy) 한 픽셀.
+  */
+static void GFX_EllipseOutline(int16_t cx, int16_t cy, int16_t rx, int16_t ry,
+                               const gfx_sector_t *sec, uint16_t color) {
+    gfx_ellipse_t e;
+    int16_t dy, hw, next, a;
+    int16_t vx = -1, v0 = 0;   // 모으는 중인 세로 run (x 오프셋, 시작 dy)
+
+    if (!GFX_Visible(cx - rx, cy - ry, 2 * rx + 1, 2 * ry + 1)) return;
+    GFX_EllipseBegin(&e, rx, ry);
+    hw = GFX_EllipseRow(&e, 0);
+    for (dy = 0; dy <= ry; dy++) {
+        next = (dy < ry) ? GFX_EllipseRow(&e, dy + 1) : -1;
+        a = next + 1;
+        if (a > hw) a = hw;
+
+        if (!sec && a == hw && a > 0) {
+            // 1픽셀 run: 같은 x가 이어지면 세로 run 하나로 합침
+            if (vx != hw) {
+                if (vx >= 0) GFX_OutlineColumn(cx, cy, vx, v0, dy - 1, color);
+                vx = hw;
+                v0 = dy;
+            }
+        } else {
+            if (vx >= 0) GFX_OutlineColumn(cx, cy, vx, v0, dy - 1, color);
+            vx = -1;
+            GFX_OutlineRow(cx, cy, dy, a, hw, sec, color);
+        }
+        hw = next;
+    }
+    if (vx >= 0) GFX_OutlineColumn(cx, cy, vx, v0, ry, color);
+}
+
+/**
+  * @brief  원 테두리 (1픽셀)
+  * @param  cx, cy: 중심 좌표
+  * @param  r: 반지름 (0이면 점 하나)
+  * @param  color: 색상 (16비트 RGB565)
+  */
+void GFX_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    if (r < 0) return;
+    GFX_EllipseOutline(cx, cy, r, r, 0, color);
+}
+
+/**
+  * @brief  채운 원 (행마다 span 하나)
+  */
+void GFX_FillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t color) {
+    GFX_FillEllipse(cx, cy, r, r, color);
+}
+
+/**
+  * @brief  타원 테두리 (1픽셀, 축 정렬)
+  * @param  cx, cy: 중심 좌표
+  * @param  rx, ry: 가로, 세로 반지름
+  */
+void GFX_DrawEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color) {
+    if (rx < 0 || ry < 0) return;
+    GFX_EllipseOutline(cx, cy, rx, ry, 0, color);
+}
+
+/**
+  * @brief  채운 타원 (행마다 span 하나, 축 정렬)
+  */
+void GFX_FillEllipse(int16_t cx, int16_t cy, int16_t rx, int16_t ry, uint16_t color) {
+    gfx_ellipse_t e;
+    int16_t dy, hw;
+
+    if (rx < 0 || ry < 0 || !GFX_Visible(cx - rx, cy - ry, 2 * rx + 1, 2 * ry + 1)) return;
+    GFX_EllipseBegin(&e, rx, ry);
+    for (dy = 0; dy <= ry; dy++) {
+        hw = GFX_EllipseRow(&e, dy);
+        GFX_FillClipped(cx - hw, cy + dy, 2 * hw + 1, 1, color);
+        if (dy) GFX_FillClipped(cx - hw, cy - dy, 2 * hw + 1, 1, color);
+    }
+}
+
+/**
+  * @brief  원호 테두리 (1픽셀)
+  * @param  cx, cy: 중심 좌표
+  * @param  r: 반지름
+  * @param  start_deg, end_deg: 시작/끝 각도 (0도 = 3시 방향, 시계 방향, 시작 = 끝이면 한 바퀴)
+  */
+void GFX_DrawArc(int16_t cx, int16_t cy, int16_t r, int16_t start_deg, int16_t end_deg, uint16_t color) {
+    gfx_sector_t sec;
+
+    if (r < 0) return;
+    GFX_SectorInit(&sec, start_deg, end_deg);
+    GFX_EllipseOutline(cx, cy, r, r, &sec, color);
+}
+
+/**
+  * @brief  채운 원호 (게이지용 고리 조각). r_inner = 0이면 부채꼴.
+  *         반지름 r_inner ~ r_outer 사이 픽셀을 행마다 최대 2개 span으로 채운다.
+  * @param  cx, cy: 중심 좌표
+  * @param  r_outer, r_inner: 바깥/안쪽 반지름 (둘 다 포함)
+  * @param  start_deg, end_deg: 시작/끝 각도 (GFX_DrawArc와 같음)
+  */
+void GFX_FillArc(int16_t cx, int16_t cy, int16_t r_outer, int16_t r_inner,
+                 int16_t start_deg, int16_t end_deg, uint16_t color) {
+    gfx_sector_t sec;
+    gfx_ellipse_t eo, ei;
+    int16_t dy, ho, hi;
+    uint8_t k;
+
+    if (r_outer < 0 || r_inner > r_outer) return;
+    if (!GFX_Visible(cx - r_outer, cy - r_outer, 2 * r_outer + 1, 2 * r_outer + 1)) return;
+    GFX_SectorInit(&sec, start_deg, end_deg);
+    GFX_EllipseBegin(&eo, r_outer, r_outer);
+    if (r_inner > 0) GFX_EllipseBegin(&ei, r_inner - 1, r_inner - 1);   // 이 원의 안쪽을 비움
+
+    for (dy = 0; dy <= r_outer; dy++) {
+        ho = GFX_EllipseRow(&eo, dy);
+        hi = (r_inner > 0 && dy < r_inner) ? GFX_EllipseRow(&ei, dy) : -1;
+        for (k = 0; k < (dy ? 2 : 1); k++) {
+            int16_t y = k ? -dy : dy;
+            if (hi < 0) {
+                GFX_SectorSpan(&sec, cx, cy, y, -ho, ho, color);
+            } else {
+                GFX_SectorSpan(&sec, cx, cy, y, hi + 1, ho, color);
+                GFX_SectorSpan(&sec, cx, cy, y, -ho, -hi - 1, color);
+            }
+        }
+    }
+}
+
+// ====================================================================
+// ==== 삼각형 / 볼록 다각형 (고정소수점 스캔라인) =====================
+// ====================================================================
+// 꼭짓점은 1/GFX_SUBPIXEL 픽셀 단위 고정소수점이라 애니메이션 중에도 모양이 픽셀 단위로 튀지 않는다.
+// 픽셀 (i, j)의 중심 (i + 0.5, j + 0.5)이 도형 안에 있으면 칠한다 (위/왼쪽 변 포함, 아래/오른쪽 변 제외).
+// 변의 x는 행마다 몫/나머지를 더하는 정확한 정수 DDA로 구하므로 나눗셈은 변마다 한 번뿐이다.
+#define GFX_SUB_HALF   (GFX_SUBPIXEL / 2)
+
+// 스캔라인 하나를 따라 내려가는 변
+typedef struct {
+    int32_t x;       // 현재 샘플 행에서의 x (서브픽셀, 내림. 정확한 값 = x + err / dy)
+    int32_t q, r;    // 한 행(GFX_SUBPIXEL) 내려갈 때 x 증가량의 몫과 나머지
+    int32_t err;     // 나머지 누적 (0 <= err < dy)
+    int32_t dy;      // 변의 세로 길이 (서브픽셀, > 0)
+    int32_t y_end;   // 변의 끝 y (서브픽셀, 이 y 이상인 행부터는 다음 변)
+} gfx_edge_t;
+
+// 샘플 행 j의 서브픽셀 y
+#define GFX_ROW_Y(j)   ((int32_t)(j) * GFX_SUBPIXEL + GFX_SUB_HALF)
+
+/**
+  * @brief  (xa, ya) -> (xb, yb) 변을 샘플 행 j에 맞춰 준비 (ya < yb)
+  */
+static void GFX_EdgeBegin(gfx_edge_t *e, int32_t xa, int32_t ya, int32_t xb, int32_t yb, int32_t j) {
+    int32_t dx = xb - xa;
+    int32_t num = (GFX_ROW_Y(j) - ya) * dx;
+
+    e->dy = yb - ya;
+    e->y_end = yb;
+    e->x = xa + GFX_DivFloor(num, e->dy);
+    e->err = num - GFX_DivFloor(num, e->dy) * e->dy;
+    e->q = GFX_DivFloor(dx * GFX_SUBPIXEL, e->dy);
+    e->r = dx * GFX_SUBPIXEL - e->q * e->dy;
+}
+
+static void GFX_EdgeStep(gfx_edge_t *e) {
+    e->x += e->q;
+    e->err += e->r;
+    if (e->err >= e->dy) {
+        e->x++;
+        e->err -= e->dy;
+    }
+}
+
+// 서브픽셀 x 이상인 첫 픽셀 중심의 픽셀 번호
+static int32_t GFX_FirstPixel(int32_t x) {
+    return GFX_DivCeil(x - GFX_SUB_HALF, GFX_SUBPIXEL);
+}
+
+/**
+  * @brief  체인을 따라 행 j를 포함하는 다음 변으로 진행 (vertex 인덱스를 dir 방향으로 이동)
+  * @retval 1: 변 준비됨, 0: 체인 끝
+  */
+static uint8_t GFX_ChainNext(const gfx_point_t *pts, uint8_t n, uint8_t *idx, int8_t dir,
+                             int32_t j, gfx_edge_t *e) {
+    int32_t y = GFX_ROW_Y(j);
+    uint8_t guard;
+
+    for (guard = 0; guard < n; guard++) {
+        uint8_t a = *idx;
+        uint8_t b = (uint8_t)((a + n + dir) % n);
+        if (pts[b].y < pts[a].y) return 0;   // 아래쪽 꼭짓점을 지나 다시 올라가는 변 = 체인 끝
+        *idx = b;
+        if (pts[b].y > y) {
+            GFX_EdgeBegin(e, pts[a].x, pts[a].y, pts[b].x, pts[b].y, j);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+  * @brief  볼록 다각형 채우기 (꼭짓점 순서는 시계/반시계 아무거나)
+  *         맨 위 꼭짓점에서 양쪽 체인을 동시에 내려가며 행마다 span 하나를 출력한다.
+  * @param  pts: 꼭짓점 배열 (서브픽셀 좌표, GFX_FX()로 픽셀 좌표 변환)
+  * @param  n: 꼭짓점 수 (3 이상)
+  * @param  color: 색상 (16비트 RGB565)
+  */
+void GFX_FillPolygonFx(const gfx_point_t *pts, uint8_t n, uint16_t color) {
+    gfx_edge_t ea, eb;
+    uint8_t ia, ib, i, top = 0;
+    int32_t j, y_max, x_min, x_max;
+
+    if (n < 3) return;
+    y_max = pts[0].y;
+    x_min = x_max = pts[0].x;
+    for (i = 1; i < n; i++) {
+        if (pts[i].y < pts[top].y) top = i;
+        if (pts[i].y > y_max) y_max = pts[i].y;
+        if (pts[i].x < x_min) x_min = pts[i].x;
+        if (pts[i].x > x_max) x_max = pts[i].x;
+    }
+    // 외곽 사각형(픽셀)이 클립 영역 밖이면 행을 돌기 전에 버림
+    x_min >>= GFX_SUBPIXEL_BITS;
+    x_max >>= GFX_SUBPIXEL_BITS;
+    if (!GFX_Visible(x_min, pts[top].y >> GFX_SUBPIXEL_BITS, x_max - x_min + 1,
+                       (y_max >> GFX_SUBPIXEL_BITS) - (pts[top].y >> GFX_SUBPIXEL_BITS) + 1)) return;
+
+    // 첫 샘플 행: 중심이 맨 위 꼭짓점 이상인 행 (클립 영역 위쪽은 건너뜀)
+    j = GFX_FirstPixel(pts[top].y);
+    if (j < gfx_clip.y0 - gfx_clip.oy) j = gfx_clip.y0 - gfx_clip.oy;
+    ia = ib = top;
+    if (!GFX_ChainNext(pts, n, &ia, 1, j, &ea)) return;
+    if (!GFX_ChainNext(pts, n, &ib, -1, j, &eb)) return;
+
+    for (; GFX_ROW_Y(j) < y_max && j < gfx_clip.y1 - gfx_clip.oy; j++) {
+        int32_t y = GFX_ROW_Y(j);
+        int32_t xl, xr;
+
+        if (y >= ea.y_end && !GFX_ChainNext(pts, n, &ia, 1, j, &ea)) break;
+        if (y >= eb.y_end && !GFX_ChainNext(pts, n, &ib, -1, j, &eb)) break;
+
+        // 정확한 교점 x를 올림한 값 (픽셀 중심은 정수 서브픽셀 좌표이므로 비교 결과가 같다)
+        xl = ea.x + (ea.err != 0);
+        xr = eb.x + (eb.err != 0);
+        if (xl > xr) { int32_t t = xl; xl = xr; xr = t; }
+        xl = GFX_FirstPixel(xl);
+        xr = GFX_FirstPixel(xr);   // 오른쪽 변 위의 픽셀은 제외
+        if (xr > xl) GFX_FillClipped(xl, j, xr - xl, 1, color);
+
+        GFX_EdgeStep(&ea);
+        GFX_EdgeStep(&eb);
+    }
+}
+
+/**
+  * @brief  삼각형 채우기 (서브픽셀 좌표)
+  */
+void GFX_FillTriangleFx(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    gfx_point_t p[3] = { { x0, y0 }, { x1, y1 }, { x2, y2 } };
+    GFX_FillPolygonFx(p, 3, color);
+}
+
+/**
+  * @brief  삼각형 채우기 (정수 픽셀 좌표, 꼭짓점 = 픽셀 중심)
+  */
+void GFX_FillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    GFX_FillTriangleFx(GFX_FX(x0), GFX_FX(y0), GFX_FX(x1), GFX_FX(y1), GFX_FX(x2), GFX_FX(y2), color);
+}
+
+/**
+  * @brief  삼각형 테두리 (정수 픽셀 좌표)
+  */
+void GFX_DrawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    GFX_DrawLine(x0, y0, x1, y1, color);
+    GFX_DrawLine(x1, y1, x2, y2, color);
+    GFX_DrawLine(x2, y2, x0, y0, color);
+}
+
+// ====================================================================
+// ==== 안티앨리어싱 (Wu 방식, 알려진 배경색과 블렌딩) ================
+// ====================================================================
+// 프레임버퍼가 없으므로 화면을 읽지 않고, 호출자가 준 배경색과 전경색 사이의 RGB565 램프(GFX_AA_LEVELS 단계)를
+// 그릴 때마다 한 번 만들어 커버리지로 색을 고른다. 단색 배경 위에 그릴 때 정확하다.
+// 커버리지가 다른 픽셀들도 한 행(또는 열)에 이어져 있으면 창 하나에 스트림으로 보낸다.
+
+// 픽셀마다 색이 다른 run 출력기 (클립 영역 밖 부분은 잘라내고 안쪽만 스트림)
+typedef struct {
+    int32_t pos;       // 다음 픽셀의 주축 좌표 (화면 좌표)
+    int32_t lo, hi;    // 클립 영역 안에 들어오는 주축 구간
+    uint16_t *buf;
+    uint16_t n;        // 현재 라인 버퍼에 채운 픽셀 수
+    uint8_t open;      // 1: 창을 열었음
+} gfx_run_t;
+
+/**
+  * @brief  run 시작: (x, y)에서 가로(vertical = 0) 또는 세로로 len 픽셀
+  */
+static void GFX_RunBegin(gfx_run_t *r, int32_t x, int32_t y, int32_t len, uint8_t vertical) {
+    int32_t lo, hi, other;
+
+    x += gfx_clip.ox;   // 이후 좌표는 모두 화면 좌표
+    y += gfx_clip.oy;
+    lo = vertical ? y : x;
+    hi = lo + len - 1;
+    other = vertical ? x : y;
+
+    r->pos = lo;
+    r->n = 0;
+    r->open = 0;
+    if (vertical) {
+        if (lo < gfx_clip.y0) lo = gfx_clip.y0;
+        if (hi >= gfx_clip.y1) hi = gfx_clip.y1 - 1;
+        if (len <= 0 || lo > hi || other < gfx_clip.x0 || other >= gfx_clip.x1) return;
+        gfx_drv->stream_begin(other, lo, other, hi);
+    } else {
+        if (lo < gfx_clip.x0) lo = gfx_clip.x0;
+        if (hi >= gfx_clip.x1) hi = gfx_clip.x1 - 1;
+        if (len <= 0 || lo > hi || other < gfx_clip.y0 || other >= gfx_clip.y1) return;
+        gfx_drv->stream_begin(lo, other, hi, other);
+    }
+    r->lo = lo;
+    r->hi = hi;
+    r->buf = gfx_drv->stream_buffer();
+    r->open = 1;
+}
+
+static void GFX_RunPut(gfx_run_t *r, uint16_t color) {
+    if (r->open && r->pos >= r->lo && r->pos <= r->hi) {
+        r->buf[r->n++] = color;
+        if (r->n == gfx_drv->linebuf_pixels) {
+            gfx_drv->stream_submit(r->n);
+            r->buf = gfx_drv->stream_buffer();
+            r->n = 0;
+        }
+    }
+    r->pos++;
+}
+
+static void GFX_RunEnd(gfx_run_t *r) {
+    if (!r->open) return;
+    if (r->n) gfx_drv->stream_submit(r->n);
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  배경색 -> 전경색 램프 생성 (ramp[0] = bg, ramp[GFX_AA_LEVELS - 1] = fg)
+  */
+static void GFX_AARamp(uint16_t fg, uint16_t bg, uint16_t *ramp) {
+    int32_t fr = fg >> 11, fgg = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+    int32_t br = bg >> 11, bgg = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+    const int32_t n = GFX_AA_LEVELS - 1;
+    int32_t i;
+
+    for (i = 0; i <= n; i++) {
+        int32_t r = br + ((fr - br) * i + n / 2) / n;
+        int32_t g = bgg + ((fgg - bgg) * i + n / 2) / n;
+        int32_t b = bb + ((fb - bb) * i + n / 2) / n;
+        ramp[i] = (uint16_t)((r << 11) | (g << 5) | b);
+    }
+}
+
+// 16.16 소수부 -> 램프 단계
+#define GFX_AA_LEVEL(frac16)  ((uint8_t)(((uint32_t)(frac16) * GFX_AA_LEVELS) >> 16))
+
+/**
+  * @brief  안티앨리어싱 직선 (Wu). 주축 한 칸마다 부축 방향 두 픽셀에 커버리지를 나눠 준다.
+  *         같은 부축 좌표(완만한 선은 같은 행)에 떨어지는 픽셀들은 연속 구간이므로 행마다 창 하나로 스트림한다.
+  *         수평/수직/45도 선은 계단이 없으므로 GFX_DrawLine으로 그린다.
+  * @param  x0, y0, x1, y1: 양 끝점 (포함)
+  * @param  fg: 선 색, bg: 선 아래 배경색 (16비트 RGB565)
+  */
+void GFX_DrawLineAA(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t fg, uint16_t bg) {
+    uint16_t ramp[GFX_AA_LEVELS];
+    int32_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int32_t dy = y1 > y0 ? y1 - y0 : y0 - y1;
+    uint8_t steep = dy > dx;
+    int32_t m0, m1, n0, sn, dm, dn, a, b, e, r;
+    uint32_t g;
+
+    // 주축(m)은 증가 방향, 부축(n)은 sn 방향으로 dn만큼 이동
+    if (!steep) {
+        if (x0 > x1) { int16_t t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+        m0 = x0; m1 = x1; n0 = y0; sn = (y1 >= y0) ? 1 : -1; dm = dx; dn = dy;
+    } else {
+        if (y0 > y1) { int16_t t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+        m0 = y0; m1 = y1; n0 = x0; sn = (x1 >= x0) ? 1 : -1; dm = dy; dn = dx;
+    }
+    if (dn == 0 || dn == dm) {
+        GFX_DrawLine(x0, y0, x1, y1, fg);
+        return;
+    }
+    // 부축 방향으로 한 픽셀 더 번질 수 있으므로 외곽 사각형을 1픽셀 넓혀서 확인
+    if (!GFX_Visible((x0 < x1 ? x0 : x1) - 1, (y0 < y1 ? y0 : y1) - 1, dx + 3, dy + 3)) return;
+    GFX_AARamp(fg, bg, ramp);
+    g = (((uint32_t)dn << 16) + dm / 2) / dm;   // 주축 한 칸당 부축 이동량 (16.16)
+
+    // 주축 m에서의 부축 오프셋 (16.16). 끝점은 정확히 dn.
+#define GFX_WU_T(m)  ((m) == m1 ? ((uint32_t)dn << 16) : (uint32_t)((m) - m0) * g)
+
+    // 부축 r번째 줄에 떨어지는 주축 구간: [a, b)는 정수부가 r - 1 (아래쪽 픽셀, 커버리지 f),
+    //                                  [b, e)는 정수부가 r (위쪽 픽셀, 커버리지 1 - f)
+    a = b = m0;
+    for (r = 0; r <= dn; r++) {
+        int32_t lo, hi, m;
+        gfx_run_t run;
+
+        e = b;
+        while (e <= m1 && (int32_t)(GFX_WU_T(e) >> 16) <= r) e++;
+
+        // 커버리지 0인 양 끝 픽셀은 배경을 덮어쓰지 않도록 제외 (f는 각 구간 안에서 단조 증가)
+        lo = a;
+        while (lo < b && GFX_AA_LEVEL(GFX_WU_T(lo) & 0xFFFF) == 0) lo++;
+        hi = e - 1;
+        while (hi >= b && hi >= lo && GFX_AA_LEVEL(GFX_WU_T(hi) & 0xFFFF) == GFX_AA_LEVELS - 1) hi--;
+
+        if (lo <= hi) {
+            if (!steep) GFX_RunBegin(&run, lo, n0 + sn * r, hi - lo + 1, 0);
+            else        GFX_RunBegin(&run, n0 + sn * r, lo, hi - lo + 1, 1);
+            for (m = lo; m <= hi; m++) {
+                uint8_t lv = GFX_AA_LEVEL(GFX_WU_T(m) & 0xFFFF);
+                GFX_RunPut(&run, ramp[m < b ? lv : GFX_AA_LEVELS - 1 - lv]);
+            }
+            GFX_RunEnd(&run);
+        }
+        a = b;
+        b = e;
+    }
+#undef GFX_WU_T
+}
+
+// 원 가장자리: B(x) = sqrt(r² - x²), 소수부 6비트 (r <= GFX_AA_RADIUS_MAX에서 32비트 안에 들어감)
+#define GFX_AA_CFRAC        6
+#define GFX_AA_RADIUS_MAX   1000
+
+static uint32_t GFX_ISqrt(uint32_t v) {
+    uint32_t res = 0, bit = 1UL << 30;
+
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+static uint32_t GFX_CircleEdge(int32_t r, int32_t x) {
+    return GFX_ISqrt((uint32_t)(r * r - x * x) << (2 * GFX_AA_CFRAC));
+}
+
+// 가장자리 소수부 -> 램프 단계
+static uint8_t GFX_CircleLevel(int32_t r, int32_t x) {
+    return (uint8_t)(((GFX_CircleEdge(r, x) & ((1 << GFX_AA_CFRAC) - 1)) * GFX_AA_LEVELS) >> GFX_AA_CFRAC);
+}
+
+// x부터 앞으로만 진행하며 정수 가장자리 floor(B(x))가 k보다 작아지는 첫 x를 찾음 (x > r이면 원 밖)
+static int32_t GFX_CircleScan(int32_t r, int32_t x, int32_t k) {
+    while (x <= r && (int32_t)(GFX_CircleEdge(r, x) >> GFX_AA_CFRAC) >= k) x++;
+    return x;
+}
+
+/**
+  * @brief  안티앨리어싱 원 테두리 (Wu 원, 1픽셀 두께)
+  *         가운데 행(|y| <= r/√2)은 가장자리가 세로에 가까워 행 방향으로 두 픽셀에 커버리지를 나누고,
+  *         위/아래 행은 열 방향 커버리지를 같은 행끼리 모아 행마다 좌우 run(맞닿으면 하나)으로 스트림한다.
+  * @param  cx, cy: 중심 좌표
+  * @param  r: 반지름 (0 ~ GFX_AA_RADIUS_MAX)
+  * @param  fg: 선 색, bg: 배경색 (16비트 RGB565)
+  */
+void GFX_DrawCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t fg, uint16_t bg) {
+    uint16_t ramp[GFX_AA_LEVELS];
+    const uint8_t top = GFX_AA_LEVELS - 1;
+    int32_t a, y, pa, pb, pc;
+    gfx_run_t run;
+    uint8_t k;
+
+    if (r < 0 || r > GFX_AA_RADIUS_MAX) return;
+    if (!GFX_Visible(cx - r - 1, cy - r - 1, 2 * r + 3, 2 * r + 3)) return;
+    GFX_AARamp(fg, bg, ramp);
+    a = GFX_ISqrt((uint32_t)r * r / 2);
+
+    // 가운데 행: 가장자리 x = B(y), 픽셀 floor(B)에 1 - f, floor(B) + 1에 f
+    for (y = 0; y <= a; y++) {
+        uint32_t b = GFX_CircleEdge(r, y);
+        int32_t fb = b >> GFX_AA_CFRAC;
+        uint8_t lv = GFX_CircleLevel(r, y);
+        uint8_t n = lv ? 2 : 1;            // f가 0이면 바깥 픽셀은 배경 그대로
+
+        for (k = 0; k < (y ? 2 : 1); k++) {
+            int32_t row = cy + (k ? -y : y);
+            GFX_RunBegin(&run, cx + fb, row, n, 0);
+            GFX_RunPut(&run, ramp[top - lv]);
+            if (lv) GFX_RunPut(&run, ramp[lv]);
+            GFX_RunEnd(&run);
+            GFX_RunBegin(&run, cx - fb - (n - 1), row, n, 0);
+            if (lv) GFX_RunPut(&run, ramp[lv]);
+            GFX_RunPut(&run, ramp[top - lv]);
+            GFX_RunEnd(&run);
+        }
+    }
+
+    // 위/아래 행: 열 x의 가장자리 y = B(x). 행 y에는 floor(B) = y인 열(1 - f)과 floor(B) = y - 1인 열(f)이 온다.
+    // P(k) = floor(B(x)) < k인 첫 x 로 두면 [P(y+1), P(y))와 [P(y), P(y-1)) 구간이다.
+    pa = pb = 0;
+    for (y = r + 1; y > a; y--) {
+        int32_t lo, hi, x;
+
+        pc = GFX_CircleScan(r, pb, y - 1);
+        lo = pa;
+        while (lo < pb && GFX_CircleLevel(r, lo) == top) lo++;
+        hi = pc - 1;
+        while (hi >= pb && hi >= lo && GFX_CircleLevel(r, hi) == 0) hi--;
+
+        if (lo <= hi) {
+            for (k = 0; k < 2; k++) {
+                int32_t row = cy + (k ? -y : y);
+                if (lo == 0) {
+                    GFX_RunBegin(&run, cx - hi, row, 2 * hi + 1, 0);
+                    for (x = -hi; x <= hi; x++) {
+                        int32_t ax = x < 0 ? -x : x;
+                        uint8_t lv = GFX_CircleLevel(r, ax);
+                        GFX_RunPut(&run, ramp[ax < pb ? top - lv : lv]);
+                    }
+                    GFX_RunEnd(&run);
+                } else {
+                    GFX_RunBegin(&run, cx - hi, row, hi - lo + 1, 0);
+                    for (x = hi; x >= lo; x--) {
+                        uint8_t lv = GFX_CircleLevel(r, x);
+                        GFX_RunPut(&run, ramp[x < pb ? top - lv : lv]);
+                    }
+                    GFX_RunEnd(&run);
+                    GFX_RunBegin(&run, cx + lo, row, hi - lo + 1, 0);
+                    for (x = lo; x <= hi; x++) {
+                        uint8_t lv = GFX_CircleLevel(r, x);
+                        GFX_RunPut(&run, ramp[x < pb ? top - lv : lv]);
+                    }
+                    GFX_RunEnd(&run);
+                }
+            }
+        }
+        pa = pb;
+        pb = pc;
+    }
+}
+
+/**
+  * @brief  안티앨리어싱 채운 원. 안쪽 픽셀(중심이 원 안)은 전경색, 바로 바깥 픽셀은 커버리지 f로 블렌딩.
+  *         행마다 [가장자리 - 안쪽 - 가장자리]를 창 하나로 스트림한다.
+  * @param  cx, cy: 중심 좌표
+  * @param  r: 반지름 (0 ~ GFX_AA_RADIUS_MAX)
+  * @param  fg: 채울 색, bg: 배경색 (16비트 RGB565)
+  */
+void GFX_FillCircleAA(int16_t cx, int16_t cy, int16_t r, uint16_t fg, uint16_t bg) {
+    uint16_t ramp[GFX_AA_LEVELS];
+    int32_t a, y, ps, pe, i;
+    gfx_run_t run;
+    uint8_t k;
+
+    if (r < 0 || r > GFX_AA_RADIUS_MAX) return;
+    if (!GFX_Visible(cx - r - 1, cy - r - 1, 2 * r + 3, 2 * r + 3)) return;
+    GFX_AARamp(fg, bg, ramp);
+    a = GFX_ISqrt((uint32_t)r * r / 2);
+
+    // 가운데 행: 안쪽 |x| <= floor(B(y)), 양 끝 한 픽셀씩 커버리지 f
+    for (y = 0; y <= a; y++) {
+        int32_t fb = GFX_CircleEdge(r, y) >> GFX_AA_CFRAC;
+        uint8_t lv = GFX_CircleLevel(r, y);
+
+        for (k = 0; k < (y ? 2 : 1); k++) {
+            int32_t row = cy + (k ? -y : y);
+            if (lv == 0) {
+                GFX_FillClipped(cx - fb, row, 2 * fb + 1, 1, fg);
+                continue;
+            }
+            GFX_RunBegin(&run, cx - fb - 1, row, 2 * fb + 3, 0);
+            GFX_RunPut(&run, ramp[lv]);
+            for (i = 0; i < 2 * fb + 1; i++) GFX_RunPut(&run, fg);
+            GFX_RunPut(&run, ramp[lv]);
+            GFX_RunEnd(&run);
+        }
+    }
+
+    // 위/아래 행: 안쪽 열 [0, P(y)), 가장자리 열 [P(y), P(y-1))
+    ps = 0;
+    for (y = r + 1; y > a; y--) {
+        int32_t x;
+
+        pe = GFX_CircleScan(r, ps, y - 1);
+        i = pe;
+        while (i > ps && GFX_CircleLevel(r, i - 1) == 0) i--;   // 커버리지 0인 바깥 끝은 제외
+
+        if (i > 0) {
+            for (k = 0; k < 2; k++) {
+                GFX_RunBegin(&run, cx - (i - 1), cy + (k ? -y : y), 2 * i - 1, 0);
+                for (x = -(i - 1); x < i; x++) {
+                    int32_t ax = x < 0 ? -x : x;
+                    GFX_RunPut(&run, ax < ps ? fg : ramp[GFX_CircleLevel(r, ax)]);
+                }
+                GFX_RunEnd(&run);
+            }
+        }
+        ps = pe;
+    }
+}
+
+// ====================================================================
+// ==== 알파 마스크 / 반투명 (blend.h 커널) ===========================
+// ====================================================================
+// 라인 버퍼에서 블렌딩한 결과를 그대로 픽셀 스트림으로 보낸다.
+// 배경색을 알면 GRAM을 읽지 않고(GFX_DrawMask), 모르면 GRAM을 읽어서(GFX_BlendRect) 블렌딩한다.
+
+/**
+  * @brief  알파 마스크(A8 또는 A4)를 배경색 위에 전경색으로 그림 (안티앨리어싱 글리프/아이콘)
+  *         라인 버퍼를 배경색으로 채우고 마스크 커버리지로 전경색을 블렌딩한 뒤 바로 전송한다.
+  * @param  x, y: 시작 좌표 (클립 영역 밖이면 잘라냄)
+  * @param  w, h: 마스크의 가로, 세로 길이 (픽셀)
+  * @param  mask: 커버리지 배열 (A8: 픽셀당 1바이트, A4: 바이트당 2픽셀(상위 니블 먼저), 줄마다 바이트 정렬)
+  * @param  bits: 8 또는 4
+  * @param  fg: 전경색, bg: 배경색 (16비트 RGB565)
+  */
+void GFX_DrawMask(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *mask, uint8_t bits,
+                  uint16_t fg, uint16_t bg) {
+    uint32_t stride = (bits == 4) ? (w + 1u) / 2 : w;  // 마스크 한 줄의 바이트 수
+    uint16_t linebuf = gfx_drv->linebuf_pixels;
+    int32_t x0, y0, x1, y1, row;
+    int32_t sx = x + gfx_clip.ox, sy = y + gfx_clip.oy;   // 마스크 왼쪽 위의 화면 좌표
+
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+    for (row = y0; row < y1; row++) {
+        const uint8_t *m = mask + (uint32_t)(row - sy) * stride;
+        uint32_t col = x0 - sx;       // 마스크 안에서의 픽셀 번호
+        uint32_t left = x1 - x0;
+
+        while (left) {
+            uint16_t n = left < linebuf ? left : linebuf;
+            uint16_t *buf = gfx_drv->stream_buffer();
+            uint16_t i;
+
+            for (i = 0; i < n; i++) buf[i] = bg;
+            if (bits == 4) {
+                Blend_MaskA4(buf, fg, m, col, n);
+            } else {
+                Blend_MaskA8(buf, fg, m + col, n);
+            }
+            gfx_drv->stream_submit(n);
+            col += n;
+            left -= n;
+        }
+    }
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  화면에 이미 그려진 내용 위에 반투명 단색 직사각형을 덮음 (그림자, 비활성 표시 등)
+  *         GRAM을 GFX_BLEND_CHUNK 픽셀씩 읽어 블렌딩한 뒤 같은 자리에 다시 쓴다.
+  *         읽기는 쓰기보다 훨씬 느리므로(SPI 읽기 클럭, 픽셀당 3바이트) 작은 영역에만 사용한다.
+  *         드라이버에 read_pixels가 없으면 아무것도 하지 않는다.
+  * @param  x, y, w, h: 영역 (클립 영역 밖이면 잘라냄)
+  * @param  color: 덮을 색 (16비트 RGB565)
+  * @param  alpha: 불투명도 (0: 그대로 ~ 255: color로 채움)
+  */
+void GFX_BlendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha) {
+    uint16_t buf[GFX_BLEND_CHUNK];
+    int32_t x0, y0, x1, y1, row, col;
+
+    if (BLEND_A8_TO_A5(alpha) == 32) {
+        GFX_FillClipped(x, y, w, h, color);   // 불투명이면 읽을 필요가 없음
+        return;
+    }
+    if (BLEND_A8_TO_A5(alpha) == 0 || !gfx_drv->read_pixels) return;
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+
+    for (row = y0; row < y1; row++) {
+        for (col = x0; col < x1; col += GFX_BLEND_CHUNK) {
+            uint16_t n = (x1 - col) < GFX_BLEND_CHUNK ? (uint16_t)(x1 - col) : GFX_BLEND_CHUNK;
+
+            gfx_drv->read_pixels(col, row, n, 1, buf);   // 직전 쓰기 DMA가 끝난 뒤 읽는다
+            Blend_Fill(buf, color, alpha, n);
+            gfx_drv->stream_begin(col, row, col + n - 1, row);
+            gfx_drv->stream_write(buf, n);
+            gfx_drv->stream_end();                       // buf가 스택이므로 전송 완료까지 대기
+        }
+    }
+}
+
+// ====================================================================
+// ==== 그라디언트 / 패턴 / 디더 채우기 (스캔라인 생성) ===============
+// ====================================================================
+// 색은 채널별 Q16 고정소수점(R 0~31, G 0~63, B 0~31)으로 들고 다니며 픽셀/행마다 step만 더한다.
+// 한 줄씩 라인 버퍼에 만들어 창 하나로 스트림하므로 단색 채우기에 가까운 속도로 그릴 수 있다.
+// 디더링 임계값은 화면 좌표 기준이라 나란히 붙인 채우기끼리 무늬가 이어진다.
+
+// 8x8 Bayer 행렬 (0 ~ 63)
+static const uint8_t gfx_bayer8[8][8] = {
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+// 디더링을 끄면 모든 픽셀에 0.5를 더해 반올림
+static const uint8_t gfx_bayer_flat[8] = { 32, 32, 32, 32, 32, 32, 32, 32 };
+
+static void GFX_ColorQ(uint16_t c, int32_t *q) {
+    q[0] = (int32_t)(c >> 11) << 16;
+    q[1] = (int32_t)((c >> 5) & 0x3F) << 16;
+    q[2] = (int32_t)(c & 0x1F) << 16;
+}
+
+// Q16 채널 -> RGB565. th(0 ~ 63)는 소수부에 더할 임계값 (th / 64 픽셀 단계)
+static uint16_t GFX_PackQ(const int32_t *q, uint8_t th) {
+    int32_t t = (int32_t)th << 10;
+    return (uint16_t)((((q[0] + t) >> 16) << 11) | (((q[1] + t) >> 16) << 5) | ((q[2] + t) >> 16));
+}
+
+// c0 -> c1 채널 차이를 n 단계로 나눈 Q16 step (n이 0이면 0)
+static void GFX_StepQ(uint16_t c0, uint16_t c1, int32_t n, int32_t *step) {
+    int32_t a[3], b[3];
+    uint8_t k;
+
+    GFX_ColorQ(c0, a);
+    GFX_ColorQ(c1, b);
+    for (k = 0; k < 3; k++) step[k] = n > 0 ? (b[k] - a[k]) / n : 0;
+}
+
+/**
+  * @brief  직선 그라디언트: 색 = c0 + sx * (열 - x) + sy * (행 - y)
+  *         가로(GFX_GRAD_H), 세로(GFX_GRAD_V), 대각선(GFX_GRAD_DIAG, 왼쪽 위 -> 오른쪽 아래) 방향을 지원한다.
+  * @param  x, y, w, h: 영역 (클립 영역 밖이면 잘라냄, 잘려도 색은 원래 영역 기준)
+  * @param  c0: 시작 색, c1: 끝 색 (16비트 RGB565)
+  * @param  flags: 방향 | GFX_GRAD_DITHER (선택)
+  */
+void GFX_FillGradient(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c0, uint16_t c1, uint8_t flags) {
+    uint16_t linebuf = gfx_drv->linebuf_pixels;
+    int32_t x0, y0, x1, y1, row, col;
+    int32_t sx[3] = { 0, 0, 0 }, sy[3] = { 0, 0, 0 }, q0[3], q[3];
+    uint8_t k;
+
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+
+    switch (flags & GFX_GRAD_DIR_MASK) {
+    case GFX_GRAD_V:
+        GFX_StepQ(c0, c1, h - 1, sy);
+        break;
+    case GFX_GRAD_DIAG:
+        // 양 끝 꼭짓점에서 c0, c1이 되도록 가로/세로에 절반씩 나눔
+        GFX_StepQ(c0, c1, 2 * (w - 1), sx);
+        GFX_StepQ(c0, c1, 2 * (h - 1), sy);
+        if (w == 1) for (k = 0; k < 3; k++) sy[k] *= 2;
+        if (h == 1) for (k = 0; k < 3; k++) sx[k] *= 2;
+        break;
+    default: // GFX_GRAD_H
+        GFX_StepQ(c0, c1, w - 1, sx);
+        break;
+    }
+
+    // 잘린 만큼 시작 색을 옮김
+    GFX_ColorQ(c0, q0);
+    for (k = 0; k < 3; k++) q0[k] += sx[k] * (x0 - x - gfx_clip.ox) + sy[k] * (y0 - y - gfx_clip.oy);
+
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+    for (row = y0; row < y1; row++) {
+        const uint8_t *th = (flags & GFX_GRAD_DITHER) ? gfx_bayer8[row & 7] : gfx_bayer_flat;
+
+        q[0] = q0[0]; q[1] = q0[1]; q[2] = q0[2];
+        for (col = x0; col < x1; ) {
+            uint16_t *buf = gfx_drv->stream_buffer();
+            uint16_t n = (x1 - col) < linebuf ? (uint16_t)(x1 - col) : linebuf;
+            uint16_t i;
+
+            for (i = 0; i < n; i++, col++) {
+                buf[i] = GFX_PackQ(q, th[col & 7]);
+                q[0] += sx[0]; q[1] += sx[1]; q[2] += sx[2];
+            }
+            gfx_drv->stream_submit(n);
+        }
+        q0[0] += sy[0]; q0[1] += sy[1]; q0[2] += sy[2];
+    }
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  원형 그라디언트: 중심에서 c0, 반지름 r 이상에서 c1
+  *         행마다 시작 픽셀의 거리만 제곱근으로 구하고, 이후 픽셀은 거리 제곱을 증분으로 갱신하며
+  *         정수 거리를 한 칸씩 따라간다 (픽셀당 거리 변화는 1 이하).
+  * @param  x, y, w, h: 채울 영역 (클립 영역 밖이면 잘라냄)
+  * @param  cx, cy: 그라디언트 중심 (영역 밖이어도 됨)
+  * @param  r: 반지름 (1 이상)
+  * @param  c0: 중심 색, c1: 바깥 색 (16비트 RGB565)
+  * @param  flags: GFX_GRAD_DITHER (선택)
+  */
+void GFX_FillRadial(int16_t x, int16_t y, int16_t w, int16_t h, int16_t cx, int16_t cy, int16_t r,
+                    uint16_t c0, uint16_t c1, uint8_t flags) {
+    uint16_t linebuf = gfx_drv->linebuf_pixels;
+    int32_t x0, y0, x1, y1, row, col;
+    int32_t base[3], step[3], q[3];
+
+    if (r < 1 || !GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+    cx += gfx_clip.ox;    // 행/열은 화면 좌표로 돌기 때문에 중심도 화면 좌표로
+    cy += gfx_clip.oy;
+    GFX_ColorQ(c0, base);
+    GFX_StepQ(c0, c1, r, step);    // 거리 1 픽셀당 step
+
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+    for (row = y0; row < y1; row++) {
+        const uint8_t *th = (flags & GFX_GRAD_DITHER) ? gfx_bayer8[row & 7] : gfx_bayer_flat;
+        int32_t dy = row - cy;
+        int32_t dx = x0 - cx;
+        uint32_t d2 = (uint32_t)(dx * dx) + (uint32_t)(dy * dy);
+        uint32_t d = GFX_ISqrt(d2);    // floor(sqrt(d2))
+
+        for (col = x0; col < x1; ) {
+            uint16_t *buf = gfx_drv->stream_buffer();
+            uint16_t n = (x1 - col) < linebuf ? (uint16_t)(x1 - col) : linebuf;
+            uint16_t i;
+
+            for (i = 0; i < n; i++, col++) {
+                int32_t t = d < (uint32_t)r ? (int32_t)d : r;
+
+                q[0] = base[0] + step[0] * t;
+                q[1] = base[1] + step[1] * t;
+                q[2] = base[2] + step[2] * t;
+                buf[i] = GFX_PackQ(q, th[col & 7]);
+
+                d2 += 2 * dx + 1;     // (dx + 1)^2 = dx^2 + 2dx + 1
+                dx++;
+                while (d * d > d2) d--;
+                while ((d + 1) * (d + 1) <= d2) d++;
+            }
+            gfx_drv->stream_submit(n);
+        }
+    }
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  8x8 1비트 패턴을 타일로 채움 (빗금, 체크 무늬 등). 패턴은 화면 좌표 (0, 0)에 맞춰 반복된다.
+  * @param  x, y, w, h: 영역 (클립 영역 밖이면 잘라냄)
+  * @param  pattern: 8바이트, pattern[행 & 7]의 비트 7이 열 0 (1: fg, 0: bg)
+  * @param  fg, bg: 색상 (16비트 RGB565)
+  */
+void GFX_FillPattern(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *pattern, uint16_t fg, uint16_t bg) {
+    uint16_t linebuf = gfx_drv->linebuf_pixels;
+    uint16_t tile[8];
+    int32_t x0, y0, x1, y1, row, col;
+    uint8_t k;
+
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+    for (row = y0; row < y1; row++) {
+        uint8_t bits = pattern[row & 7];
+
+        for (k = 0; k < 8; k++) tile[k] = (bits & (0x80 >> k)) ? fg : bg;
+        for (col = x0; col < x1; ) {
+            uint16_t *buf = gfx_drv->stream_buffer();
+            uint16_t n = (x1 - col) < linebuf ? (uint16_t)(x1 - col) : linebuf;
+            uint16_t i;
+
+            for (i = 0; i < n; i++, col++) buf[i] = tile[col & 7];
+            gfx_drv->stream_submit(n);
+        }
+    }
+    gfx_drv->stream_end();
+}
+
+/**
+  * @brief  24비트 색을 8x8 순서 디더링으로 채움 (RGB565로 표현되지 않는 중간 톤)
+  * @param  x, y, w, h: 영역 (클립 영역 밖이면 잘라냄)
+  * @param  r, g, b: 8비트 채널 (0 ~ 255)
+  */
+void GFX_FillDither(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t r, uint8_t g, uint8_t b) {
+    uint16_t linebuf = gfx_drv->linebuf_pixels;
+    uint16_t tile[8][8];
+    int32_t q[3];
+    int32_t x0, y0, x1, y1, row, col;
+    uint8_t i, j;
+
+    if (!GFX_ClipRect(x, y, w, h, &x0, &y0, &x1, &y1)) return;
+
+    // 8비트 -> 채널 최대값 기준 Q16 (R/B: 31, G: 63)
+    q[0] = (int32_t)(((uint32_t)r * 31 << 16) / 255);
+    q[1] = (int32_t)(((uint32_t)g * 63 << 16) / 255);
+    q[2] = (int32_t)(((uint32_t)b * 31 << 16) / 255);
+    for (j = 0; j < 8; j++) {
+        for (i = 0; i < 8; i++) tile[j][i] = GFX_PackQ(q, gfx_bayer8[j][i]);
+    }
+
+    gfx_drv->stream_begin(x0, y0, x1 - 1, y1 - 1);
+    for (row = y0; row < y1; row++) {
+        const uint16_t *t = tile[row & 7];
+
+        for (col = x0; col < x1; ) {
+            uint16_t *buf = gfx_drv->stream_buffer();
+            uint16_t n = (x1 - col) < linebuf ? (uint16_t)(x1 - col) : linebuf;
+            uint16_t k;
+
+            for (k = 0; k < n; k++, col++) buf[k] = t[col & 7];
+            gfx_drv->stream_submit(n);
+        }
+    }
+    gfx_drv->stream_end();
+}
@@ -0,0 +1,110 @@
+/*
+ * lcd_par.c
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#include "lcd_par.h"
+
+// 데이터 핀 8개의 CRH 설정값 (핀당 4비트)
+#define LCD_PAR_CRH_OUTPUT 0x33333333u  // 범용 푸시-풀 출력, 50MHz
+#define LCD_PAR_CRH_INPUT  0x44444444u  // 플로팅 입력
+
+/**
+  * @brief  한 바이트 쓰기 사이클
+  *         BSRR은 리셋(상위 16비트)과 셋(하위 16비트)을 동시에 쓸 수 있고, 둘 다 1이면 셋이 우선한다.
+  *         그래서 "데이터 핀 전부 리셋 + 1인 비트만 셋 + WR 리셋"이 쓰기 한 번으로 끝난다.
+  */
+static inline void LCD_PAR_put(uint8_t b) {
+    LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->BSRR,
+                       ((uint32_t)(LCD_PAR_DATA_MASK | LCD_PAR_WR_PIN) << 16) | ((uint32_t)b << LCD_PAR_DATA_SHIFT));
+    LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->BSRR, LCD_PAR_WR_PIN); // WR 상승 에지에서 패널이 데이터 래치
+}
+
+/**
+  * @brief  병렬 버스 핀 초기화 (D0~D7, WR, RD 출력, WR/RD는 HIGH로 대기)
+  */
+void LCD_PAR_init(void) {
+    init_gpio(LCD_PAR_PORT, LCD_PAR_DATA_MASK | LCD_PAR_WR_PIN | LCD_PAR_RD_PIN,
+              GPIO_MODE_OUTPUT_50MHZ_VAL, GPIO_CNF_GP_PP_OUT);
+    LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->BSRR, LCD_PAR_WR_PIN | LCD_PAR_RD_PIN);
+}
+
+/**
+  * @brief  바이트 배열 쓰기 (명령/파라미터)
+  */
+void LCD_PAR_write(const uint8_t *data, uint32_t len) {
+    while (len--) {
+        LCD_PAR_put(*data++);
+    }
+}
+
+/**
+  * @brief  RGB565 픽셀 쓰기 (상위 바이트 먼저)
+  */
+void LCD_PAR_write16(const uint16_t *data, uint32_t count) {
+    while (count--) {
+        uint16_t v = *data++;
+        LCD_PAR_put(v >> 8);
+        LCD_PAR_put(v & 0xFF);
+    }
+}
+
+/**
+  * @brief  SPI1_DMA_write16과 같은 형태의 쓰기. 전송을 끝낸 뒤 바로 done을 호출한다.
+  */
+void LCD_PAR_write16_async(const uint16_t *data, uint32_t count, void (*done)(void)) {
+    LCD_PAR_write16(data, count);
+    if (done) done();
+}
+
+/**
+  * @brief  같은 색으로 count 픽셀 채우기. 전송을 끝낸 뒤 바로 done을 호출한다.
+  *         상위/하위 바이트가 같은 색(검정, 흰색 등)은 데이터 핀을 한 번만 설정하고 WR만 토글한다.
+  */
+void LCD_PAR_fill16(uint16_t value, uint32_t count, void (*done)(void)) {
+    uint8_t hi = value >> 8, lo = value & 0xFF;
+
+    if (count && hi == lo) {
+        LCD_PAR_put(hi);
+        count = count * 2 - 1;
+        while (count--) {
+            LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->BRR, LCD_PAR_WR_PIN);
+            LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->BSRR, LCD_PAR_WR_PIN);
+        }
+    } else {
+        while (count--) {
+            LCD_PAR_put(hi);
+            LCD_PAR_put(lo);
+        }
+    }
+    if (done) done();
+}
+
+/**
+  * @brief  읽기 구간 시작: 데이터 핀을 입력으로 전환
+  */
+void LCD_PAR_read_begin(void) {
+    LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->CRH, LCD_PAR_CRH_INPUT);
+}
+
+/**
+  * @brief  바이트 읽기 (RD LOW -> 대기 -> 데이터 샘플 -> RD HIGH)
+  */
+void LCD_PAR_read(uint8_t *data, uint32_t len) {
+    while (len--) {
+        volatile uint8_t d = LCD_PAR_RD_DELAY;
+        LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->BRR, LCD_PAR_RD_PIN);
+        while (d--);                                   // 패널 읽기 접근 시간 대기
+        *data++ = (LCD_PAR_PORT->IDR >> LCD_PAR_DATA_SHIFT) & 0xFF;
+        LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->BSRR, LCD_PAR_RD_PIN);
+    }
+}
+
+/**
+  * @brief  읽기 구간 종료: 데이터 핀을 다시 출력으로 전환
+  */
+void LCD_PAR_read_end(void) {
+    LCD_PAR_GPIO_WRITE(LCD_PAR_PORT->CRH, LCD_PAR_CRH_OUTPUT);
+}
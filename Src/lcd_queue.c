@@ -0,0 +1,248 @@
+/*
+ * lcd_queue.c
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#include "lcd_queue.h"
+
+// 명령 종류
+#define LCD_OP_FILL_RECT  0   // 단색 직사각형 (DMA, 고정 소스)
+#define LCD_OP_IMAGE16    1   // RGB565 버퍼 (DMA, 증가 소스)
+#define LCD_OP_MARKER     2   // 픽셀 전송 없이 콜백만 호출 (배치 완료 알림)
+
+typedef struct {
+    uint8_t  type;
+    uint16_t x, y, w, h;           // 클리핑이 끝난 영역
+    uint16_t color;                // LCD_OP_FILL_RECT
+    const uint16_t *image;         // LCD_OP_IMAGE16: 다음에 보낼 줄의 시작
+    uint16_t stride;               // LCD_OP_IMAGE16: 원본 한 줄의 픽셀 수
+    lcd_queue_cb_t done;
+    void *arg;
+} lcd_op_t;
+
+static lcd_op_t lcd_queue[LCD_QUEUE_DEPTH];
+static volatile uint8_t lcd_queue_head = 0;     // 다음에 넣을 위치 (main)
+static volatile uint8_t lcd_queue_tail = 0;     // 실행 중인 명령 위치 (ISR)
+static volatile uint8_t lcd_queue_count = 0;    // 대기 + 실행 중인 명령 수
+static volatile uint8_t lcd_queue_running = 0;  // 1: 명령 실행 중 (DMA 체인 동작 중)
+static volatile uint16_t lcd_queue_rows_left;   // LCD_OP_IMAGE16: 남은 줄 수 (클리핑된 이미지)
+
+static uint8_t  lcd_queue_high_water = 0;
+static uint32_t lcd_queue_stalls = 0;
+static volatile uint32_t lcd_queue_completed = 0;
+
+static void LCD_Queue_Start(void);
+
+/**
+  * @brief  현재 명령 완료 처리: CS 해제 -> 콜백 -> 다음 명령 시작 (DMA ISR 문맥)
+  */
+static void LCD_Queue_OpDone(void) {
+    lcd_op_t *op = &lcd_queue[lcd_queue_tail];
+
+    if (op->type != LCD_OP_MARKER) {
+        ILI9341_EndWrite();
+    }
+    if (op->done) op->done(op->arg);
+
+    lcd_queue_tail = (lcd_queue_tail + 1) % LCD_QUEUE_DEPTH;
+    lcd_queue_count--;
+    lcd_queue_completed++;
+    LCD_Queue_Start();
+}
+
+/**
+  * @brief  클리핑된 이미지의 한 줄 전송 완료 (DMA ISR 문맥). 남은 줄이 있으면 계속 전송.
+  */
+static void LCD_Queue_RowDone(void) {
+    lcd_op_t *op = &lcd_queue[lcd_queue_tail];
+
+    if (--lcd_queue_rows_left) {
+        op->image += op->stride;
+        LCD_BUS_write16_async(op->image, op->w, LCD_Queue_RowDone);
+    } else {
+        LCD_Queue_OpDone();
+    }
+}
+
+/**
+  * @brief  큐 맨 앞 명령 실행 시작. 큐가 비었으면 실행 중 상태를 해제.
+  *         영역 설정(11바이트)은 블로킹으로 보내고, 픽셀 데이터는 DMA로 넘긴다.
+  */
+static void LCD_Queue_Start(void) {
+    lcd_op_t *op;
+
+    if (lcd_queue_count == 0) {
+        lcd_queue_running = 0;
+        return;
+    }
+    lcd_queue_running = 1;
+    op = &lcd_queue[lcd_queue_tail];
+
+    switch (op->type) {
+    case LCD_OP_FILL_RECT:
+        ILI9341_BeginWrite(op->x, op->y, op->x + op->w - 1, op->y + op->h - 1);
+        ILI9341_AdvanceWrite((uint32_t)op->w * op->h);
+        LCD_BUS_fill16(op->color, (uint32_t)op->w * op->h, LCD_Queue_OpDone);
+        break;
+    case LCD_OP_IMAGE16:
+        ILI9341_BeginWrite(op->x, op->y, op->x + op->w - 1, op->y + op->h - 1);
+        ILI9341_AdvanceWrite((uint32_t)op->w * op->h); // 줄 단위로 나눠 보내도 창 전체를 채움
+        if (op->w == op->stride) {
+            LCD_BUS_write16_async(op->image, (uint32_t)op->w * op->h, LCD_Queue_OpDone);
+        } else {
+#if LCD_BUS == LCD_BUS_PAR8
+            // 병렬 버스는 전송이 바로 끝나므로 줄 완료 콜백을 중첩 호출하지 않고 반복으로 전송
+            for (lcd_queue_rows_left = op->h; lcd_queue_rows_left; lcd_queue_rows_left--) {
+                LCD_BUS_write16(op->image, op->w);
+                op->image += op->stride;
+            }
+            LCD_Queue_OpDone();
+#else
+            lcd_queue_rows_left = op->h;  // 클리핑된 이미지는 한 줄씩 전송
+            LCD_BUS_write16_async(op->image, op->w, LCD_Queue_RowDone);
+#endif
+        }
+        break;
+    default: // LCD_OP_MARKER
+        LCD_Queue_OpDone();
+        break;
+    }
+}
+
+/**
+  * @brief  큐에 명령 추가. 가득 차 있으면 자리가 날 때까지 기다리고 stall 횟수를 센다.
+  *         DMA가 쉬고 있으면 바로 실행을 시작한다.
+  */
+static void LCD_Queue_Push(const lcd_op_t *op) {
+    if (lcd_queue_count >= LCD_QUEUE_DEPTH) {
+        lcd_queue_stalls++;
+        while (lcd_queue_count >= LCD_QUEUE_DEPTH);
+    }
+
+    lcd_queue[lcd_queue_head] = *op;
+    lcd_queue_head = (lcd_queue_head + 1) % LCD_QUEUE_DEPTH;
+
+    if (!lcd_queue_running) {
+        ILI9341_WaitDone(); // 큐 밖에서 시작한 DMA(GFX_FillScreen 등)가 끝난 뒤에 버스 사용
+    }
+
+#if LCD_BUS == LCD_BUS_PAR8
+    // 병렬 버스는 명령이 main 문맥에서 CPU로 바로 실행되므로 ISR과 공유하는 상태가 없다.
+    // 인터럽트를 막은 채로 전송하면 SysTick이 밀리므로 막지 않는다.
+    lcd_queue_count++;
+    if (lcd_queue_count > lcd_queue_high_water) lcd_queue_high_water = lcd_queue_count;
+    if (!lcd_queue_running) {
+        LCD_Queue_Start();
+    }
+#else
+    __disable_irq();  // count/running은 DMA ISR과 공유
+    lcd_queue_count++;
+    if (lcd_queue_count > lcd_queue_high_water) lcd_queue_high_water = lcd_queue_count;
+    if (!lcd_queue_running) {
+        LCD_Queue_Start();
+    }
+    __enable_irq();
+#endif
+}
+
+/**
+  * @brief  단색 직사각형 그리기를 큐에 추가 (비블로킹)
+  * @param  x, y: 시작 좌표
+  * @param  w, h: 가로, 세로 길이
+  * @param  color: 색상 (16비트 RGB565)
+  * @param  done: 완료 콜백 (NULL 가능, DMA ISR 문맥에서 호출)
+  * @param  arg: 콜백 인자
+  */
+void LCD_Queue_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color,
+                        lcd_queue_cb_t done, void *arg) {
+    lcd_op_t op;
+    uint16_t lcd_w = ILI9341_GetWidth(), lcd_h = ILI9341_GetHeight();
+
+    if (x >= lcd_w || y >= lcd_h || w == 0 || h == 0) return;
+    if (x + w > lcd_w) w = lcd_w - x;
+    if (y + h > lcd_h) h = lcd_h - y;
+
+    op.type = LCD_OP_FILL_RECT;
+    op.x = x; op.y = y; op.w = w; op.h = h;
+    op.color = color;
+    op.image = 0; op.stride = 0;
+    op.done = done; op.arg = arg;
+    LCD_Queue_Push(&op);
+}
+
+/**
+  * @brief  RGB565 이미지 그리기를 큐에 추가 (비블로킹)
+  *         image_data는 명령이 완료될 때까지 유지되어야 한다 (Flash 상수 또는 전역 버퍼).
+  * @param  x, y: 시작 좌표
+  * @param  w, h: 이미지의 가로, 세로 길이 (픽셀)
+  * @param  image_data: RGB565 픽셀 배열
+  * @param  done: 완료 콜백 (NULL 가능, DMA ISR 문맥에서 호출)
+  * @param  arg: 콜백 인자
+  */
+void LCD_Queue_Image16(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *image_data,
+                       lcd_queue_cb_t done, void *arg) {
+    lcd_op_t op;
+    uint16_t lcd_w = ILI9341_GetWidth(), lcd_h = ILI9341_GetHeight();
+
+    if (x >= lcd_w || y >= lcd_h || w == 0 || h == 0) return;
+    op.stride = w;
+    if (x + w > lcd_w) w = lcd_w - x;
+    if (y + h > lcd_h) h = lcd_h - y;
+
+    op.type = LCD_OP_IMAGE16;
+    op.x = x; op.y = y; op.w = w; op.h = h;
+    op.color = 0;
+    op.image = image_data;
+    op.done = done; op.arg = arg;
+    LCD_Queue_Push(&op);
+}
+
+/**
+  * @brief  배치 완료 알림을 큐에 추가. 앞서 넣은 명령이 모두 끝나면 done이 호출된다.
+  * @param  done: 완료 콜백 (DMA ISR 문맥에서 호출)
+  * @param  arg: 콜백 인자
+  */
+void LCD_Queue_Marker(lcd_queue_cb_t done, void *arg) {
+    lcd_op_t op = { 0 };
+
+    op.type = LCD_OP_MARKER;
+    op.done = done; op.arg = arg;
+    LCD_Queue_Push(&op);
+}
+
+/**
+  * @brief  큐가 비어 있고 실행 중인 명령이 없는지 확인
+  * @retval 1: 유휴, 0: 실행 중
+  */
+uint8_t LCD_Queue_IsIdle(void) {
+    return !lcd_queue_running;
+}
+
+/**
+  * @brief  큐에 쌓인 명령이 모두 끝날 때까지 대기
+  */
+void LCD_Queue_Flush(void) {
+    while (lcd_queue_running);
+}
+
+/**
+  * @brief  큐 통계 읽기 (깊이, 대기 수, 최고 수위, stall 횟수, 완료 수)
+  */
+void LCD_Queue_GetStats(lcd_queue_stats_t *stats) {
+    stats->depth = LCD_QUEUE_DEPTH;
+    stats->pending = lcd_queue_count;
+    stats->high_water = lcd_queue_high_water;
+    stats->stalls = lcd_queue_stalls;
+    stats->completed = lcd_queue_completed;
+}
+
+/**
+  * @brief  최고 수위/stall/완료 카운터 초기화
+  */
+void LCD_Queue_ResetStats(void) {
+    lcd_queue_high_water = lcd_queue_count;
+    lcd_queue_stalls = 0;
+    lcd_queue_completed = 0;
+}
@@ -4,7 +4,11 @@
 #include "spi.h"
 #include "uart.h"
 #include "ILI_9341.h"
-#include "5x5font.h"
+#include "lcd_queue.h"
+#include "gfx.h"
+#include "blend.h"
+#include "dirty.h"
+#include "strip.h"
 // FPU 관련 경고 억제 (STM32CubeIDE 등에서 자동으로 추가될 수 있음)
 #if !defined(__SOFT_FP__) && defined(__ARM_FP)
   #warning "FPU is not initialized, but the project is compiling for an FPU. Please initialize the FPU before use."
@@ -18,9 +22,15 @@
 // ==== SysTick 기반 정확한 Delay 함수 구현 ===============================
 // ====================================================================
 volatile uint32_t ms_tick_count = 0; // 1ms 단위로 카운트하는 변수
+volatile uint32_t ms_uptime = 0;     // 부팅 후 경과 시간 (ms)
 
 // SysTick 인터럽트 핸들러 (vector table에 등록되어 자동으로 호출됨)
 void SysTick_Handler(void) {
+    ms_uptime++;
+#ifdef ILI9341_TE_SIMULATE
+    // TE 배선 없이 테스트할 때 약 70Hz(14ms)로 가짜 TE 펄스 발생
+    if (ms_uptime % 14 == 0) ILI9341_TE_SimulatePulse();
+#endif
     if (ms_tick_count > 0) {
         ms_tick_count--; // ms_tick_count가 0이 될 때까지 1ms마다 감소
     }
@@ -95,66 +105,159 @@ const uint16_t small_test_image[] = {
 #define SMALL_IMAGE_WIDTH  2
 #define SMALL_IMAGE_HEIGHT 2
 
-#define FONT_CHAR_WIDTH  5 // 폰트 자체의 가로 픽셀 수 (주석 상 5)
-#define FONT_CHAR_HEIGHT 5 // 폰트 자체의 세로 픽셀 수 (주석 상 5)
-#define FONT_COL_BYTES   6 // 폰트 데이터에서 한 문자가 차지하는 바이트 수
+// 큐에 넣은 한 프레임이 모두 그려지면 호출됨 (DMA 인터럽트 문맥)
+volatile uint32_t lcd_frames_done = 0;
+void lcd_frame_done(void *arg) {
+    (void)arg;
+    lcd_frames_done++;
+}
 
-void ili9341_draw_char_custom(char c, uint16_t x, uint16_t y, uint16_t color, uint16_t bg_color, uint8_t scale) {
-    if (c < 32 || c > 32 + 95) {
-        return;
-    }
+// ====================================================================
+// ==== 블렌딩 커널 처리량 측정 (UART로 pixels/s 출력) =================
+// ====================================================================
+#define BLEND_BENCH_PIXELS 320   // 라인 버퍼 한 줄 (세로 모드 가로 240보다 넉넉하게)
+#define BLEND_BENCH_ROUNDS 200
 
-    int char_index = c - 32;
-
-    for (int col = 0; col < FONT_CHAR_WIDTH; col++) {
-        unsigned char column_data = font[char_index][col]; 
-        
-        for (int row = 0; row < FONT_CHAR_HEIGHT; row++) {
-            // 이 부분이 핵심! (row + FONT_BIT_OFFSET)으로 비트를 정확한 위치에서 읽는다.
-            if ((column_data >> (row + 2)) & 0x01) { 
-                for (int sx = 0; sx < scale; sx++) {
-                    for (int sy = 0; sy < scale; sy++) {
-                        // ILI9341_DrawPixel 함수는 네가 제공한 함수를 사용!
-                        ILI9341_DrawPixel(x + (col * scale) + sx, y + (row * scale) + sy, color);
-                    }
-                }
-            } else {
-                for (int sx = 0; sx < scale; sx++) {
-                    for (int sy = 0; sy < scale; sy++) {
-                        // ILI9341_DrawPixel 함수는 네가 제공한 함수를 사용!
-                        ILI9341_DrawPixel(x + (col * scale) + sx, y + (row * scale) + sy, bg_color);
-                    }
-                }
-            }
-        }
+static uint16_t bench_dst[BLEND_BENCH_PIXELS];
+static uint16_t bench_src[BLEND_BENCH_PIXELS];
+static uint8_t  bench_alpha[BLEND_BENCH_PIXELS];
+
+static void blend_bench_report(const char *name, uint32_t start_ms) {
+    uint32_t ms = ms_uptime - start_ms;
+    uint32_t pixels = (uint32_t)BLEND_BENCH_PIXELS * BLEND_BENCH_ROUNDS;
+
+    if (ms == 0) ms = 1;
+    UART2_transmit_string(name);
+    UART2_transmit_int(pixels / ms * 1000);
+    UART2_transmit_string(" px/s\r\n");
+}
+
+/**
+  * @brief  blend.h 커널마다 라인 버퍼 BLEND_BENCH_ROUNDS 줄을 블렌딩하는 시간을 재서 출력
+  *         알파/마스크는 0과 255가 섞인 값을 써서 마스크 커널의 건너뛰기 경로도 포함한다.
+  */
+static void blend_benchmark(void) {
+    uint32_t i, t;
+
+    for (i = 0; i < BLEND_BENCH_PIXELS; i++) {
+        bench_dst[i] = (uint16_t)(i * 0x0421);
+        bench_src[i] = (uint16_t)(0xFFFF - i * 0x0841);
+        bench_alpha[i] = (uint8_t)(i * 5);
     }
+
+    t = ms_uptime;
+    for (i = 0; i < BLEND_BENCH_ROUNDS; i++) Blend_Alpha8(bench_dst, bench_src, bench_alpha, BLEND_BENCH_PIXELS);
+    blend_bench_report("Blend alpha8: ", t);
+
+    t = ms_uptime;
+    for (i = 0; i < BLEND_BENCH_ROUNDS; i++) Blend_Const(bench_dst, bench_src, 96, BLEND_BENCH_PIXELS);
+    blend_bench_report("Blend const : ", t);
+
+    t = ms_uptime;
+    for (i = 0; i < BLEND_BENCH_ROUNDS; i++) Blend_Fill(bench_dst, COLOR_BLACK, 96, BLEND_BENCH_PIXELS);
+    blend_bench_report("Blend fill  : ", t);
+
+    t = ms_uptime;
+    for (i = 0; i < BLEND_BENCH_ROUNDS; i++) Blend_Premul(bench_dst, bench_src, bench_alpha, BLEND_BENCH_PIXELS);
+    blend_bench_report("Blend premul: ", t);
+
+    t = ms_uptime;
+    for (i = 0; i < BLEND_BENCH_ROUNDS; i++) Blend_MaskA8(bench_dst, COLOR_WHITE, bench_alpha, BLEND_BENCH_PIXELS);
+    blend_bench_report("Blend A8    : ", t);
+
+    t = ms_uptime;
+    for (i = 0; i < BLEND_BENCH_ROUNDS; i++) Blend_MaskA4(bench_dst, COLOR_WHITE, bench_alpha, 0, BLEND_BENCH_PIXELS);
+    blend_bench_report("Blend A4    : ", t);
 }
 
-// --- 8. 문자열 그리기 함수 (폰트 너비, 높이, 스케일 고려하여 조정) ---
-void ili9341_draw_string_custom(const char* str, uint16_t x, uint16_t y, uint16_t color, uint16_t bg_color, uint8_t scale) {
-    uint16_t current_x = x;
-    
-    // 확대된 글자 하나의 너비 (폰트 너비 * 스케일) + 글자 간 여백 (스케일 값만큼 줄 수도 있고, 고정 값 줄 수도 있음)
-    // 여기서는 FONT_CHAR_WIDTH * scale + 1 픽셀 여백을 줘볼게.
-    const int char_rendered_width = (FONT_CHAR_WIDTH * scale) + 1; 
-    const int char_rendered_height = (FONT_CHAR_HEIGHT * scale) + 2; // 폰트 높이 * 스케일 + 줄 간 여백
-
-    while (*str) {
-        ili9341_draw_char_custom(*str, current_x, y, color, bg_color, scale);
-        current_x += char_rendered_width; // 다음 문자의 X 좌표
-
-        // 화면 너비 초과 시 줄 바꿈
-        // ILI9341의 최대 너비는 320 픽셀이야.
-        if (current_x + char_rendered_width >= 320) {
-            current_x = x; // 시작 X 위치로 리셋
-            y += char_rendered_height; // 다음 줄의 Y 좌표
-            // 화면 높이 초과 시 중단 (ILI9341 최대 높이는 240 픽셀)
-            if (y >= 240) break; 
+// ====================================================================
+// ==== 부분 갱신 데모 (변경 영역 추적) ===============================
+// ====================================================================
+// 온도 값이 바뀌면 달라진 글자 칸만 변경 영역으로 넣고, 프레임마다 합쳐진 창만 다시 그린다.
+#define TEMP_X      10
+#define TEMP_Y      30
+#define TEMP_SCALE  2
+#define TEMP_PITCH  (FONT_CHAR_WIDTH * TEMP_SCALE + 1)   // GFX_DrawString의 글자 간격
+
+static char temp_text[] = "Temp : 25.5 C";
+
+/**
+  * @brief  온도 문자열 갱신 (0.1도 단위, 0 ~ 99.9). 바뀐 글자 칸만 변경 영역으로 추가.
+  */
+static void temp_update(uint16_t t10) {
+    char digits[4];
+    uint8_t i;
+
+    digits[0] = (t10 >= 100) ? '0' + (t10 / 100) % 10 : ' ';
+    digits[1] = '0' + (t10 / 10) % 10;
+    digits[2] = '.';
+    digits[3] = '0' + t10 % 10;
+
+    for (i = 0; i < 4; i++) {
+        if (temp_text[7 + i] != digits[i]) {
+            temp_text[7 + i] = digits[i];
+            Dirty_Add(TEMP_X + (7 + i) * TEMP_PITCH, TEMP_Y,
+                      FONT_CHAR_WIDTH * TEMP_SCALE, FONT_CHAR_HEIGHT * TEMP_SCALE);
         }
-        str++;
     }
 }
 
+/**
+  * @brief  장면 다시 그리기. 변경 영역 창마다 클립을 걸고 호출하므로 창 밖 글자는 버스에 나가지 않는다.
+  */
+static void scene_redraw(void) {
+    GFX_DrawString(temp_text, TEMP_X, TEMP_Y, RGB565(255, 255, 0), RGB565(0, 0, 0), TEMP_SCALE);
+}
+
+// ====================================================================
+// ==== 원형 게이지 (스트립 렌더러로 합성) ============================
+// ====================================================================
+#define GAUGE_X     173
+#define GAUGE_Y     168
+#define GAUGE_SIZE  65          // 뷰포트 크기 (중심 = (32, 32))
+#define GAUGE_START 135         // 눈금 시작 각도 (0도 = 3시 방향, 시계 방향)
+#define GAUGE_SPAN  270
+
+static int16_t gauge_deg = 300; // 바늘 각도
+
+/**
+  * @brief  게이지 그리기 콜백 (Strip_Render가 띠마다 호출). 뷰포트 안에서 로컬 좌표로 그린다.
+  * @param  arg: 바늘 각도 (int16_t *)
+  */
+static void gauge_draw(void *arg) {
+    int16_t deg = *(int16_t *)arg;
+    int32_t c = GFX_Cos(deg), s = GFX_Sin(deg);
+    int16_t tip_x  = GFX_FX(32) + (int16_t)((20 * GFX_SUBPIXEL * c) >> 14);
+    int16_t tip_y  = GFX_FX(32) + (int16_t)((20 * GFX_SUBPIXEL * s) >> 14);
+    int16_t side_x = (int16_t)((3 * GFX_SUBPIXEL * -s) >> 14);
+    int16_t side_y = (int16_t)((3 * GFX_SUBPIXEL * c) >> 14);
+
+    GFX_PushViewport(GAUGE_X, GAUGE_Y, GAUGE_SIZE, GAUGE_SIZE);
+    GFX_DrawCircleAA(32, 32, 31, COLOR_WHITE, COLOR_BLACK);   // 띠 배경이 검은색이라 AA 테두리가 정확
+    GFX_FillArc(32, 32, 28, 22, GAUGE_START, (GAUGE_START + GAUGE_SPAN) % 360, COLOR_DARKGREY);
+    if (deg != GAUGE_START) GFX_FillArc(32, 32, 28, 22, GAUGE_START, deg % 360, COLOR_GREEN);
+    // 바늘: 서브픽셀 꼭짓점 삼각형 (각도가 조금씩 바뀌어도 모양이 픽셀 단위로 튀지 않음)
+    GFX_FillTriangleFx(tip_x, tip_y, GFX_FX(32) + side_x, GFX_FX(32) + side_y,
+                       GFX_FX(32) - side_x, GFX_FX(32) - side_y, COLOR_RED);
+    GFX_FillCircle(32, 32, 4, COLOR_WHITE);
+    GFX_PopClip();
+}
+
+static void dirty_report(void) {
+    dirty_stats_t ds;
+
+    Dirty_GetStats(&ds);
+    UART2_transmit_string("Dirty: ");
+    UART2_transmit_int(ds.frames);
+    UART2_transmit_string(" frames, ");
+    UART2_transmit_int(ds.total_windows);
+    UART2_transmit_string(" windows, ");
+    UART2_transmit_int(ds.total_pixels);
+    UART2_transmit_string(" px redrawn vs ");
+    UART2_transmit_int(ds.screen_pixels * ds.frames);
+    UART2_transmit_string(" px full repaint\r\n");
+    Dirty_ResetStats();
+}
 
 int main(void)
 {
@@ -198,29 +301,115 @@ int main(void)
 
     // --- 2단계 테스트: SPI1 및 ILI9341 LCD 초기화 및 테스트 ---
     ILI9341_init_pins(); // ILI9341 제어 핀 GPIO 초기화
-    SPI1_init();         // SPI1 주변장치 초기화
+    LCD_BUS_init();      // LCD 버스 초기화 (기본: SPI1, -DLCD_BUS=LCD_BUS_PAR8이면 병렬 버스)
     
-    // ILI9341 초기화 시퀀스 실행
-    ILI9341_init();
+    // ILI9341 초기화 시퀀스 실행 (그래픽 계층은 드라이버 인터페이스로만 패널을 다룸)
+    GFX_init(&ili9341_driver);
+    ILI9341_TE_init();   // TE 핀으로 V-blank 동기화
+    GFX_FillScreen(RGB565(0, 0, 0)); // 배경을 검은색으로
+    GFX_WaitDone();
+    uint32_t first_pixel_ms = ms_uptime; // 부팅 후 첫 화면이 다 채워진 시점
+
     UART2_transmit_string("ILI9341 LCD Initialized. Starting graphics tests.\r\n");
-    delay_ms(1000);
-    ILI9341_FillScreen(RGB565(0, 0, 0)); // 배경을 검은색으로
+    UART2_transmit_string("ILI9341 init: ");
+    UART2_transmit_int(ILI9341_GetInitTime());
+    UART2_transmit_string(" ms, boot to first pixel: ");
+    UART2_transmit_int(first_pixel_ms);
+    UART2_transmit_string(" ms\r\n");
+
+    // 상단 띠: 스캔라인 단위로 만든 디더링 그라디언트 (창 하나로 스트림)
+    GFX_FillGradient(0, 0, GFX_GetWidth(), 6, COLOR_NAVY, COLOR_CYAN, GFX_GRAD_H | GFX_GRAD_DITHER);
 
     // "Hello Cworld" 출력!
     // 스케일 1 (기본 5x5 폰트)
-    ili9341_draw_string_custom("Hello Cworld!", 10, 10, RGB565(0, 255, 0), RGB565(0, 0, 0), 1); 
+    GFX_DrawString("Hello Cworld!", 10, 10, RGB565(0, 255, 0), RGB565(0, 0, 0), 1); 
 
     // 스케일 2 (10x10 폰트처럼 보임)
-    ili9341_draw_string_custom("Temp : 25.5 C", 10, 30, RGB565(255, 255, 0), RGB565(0, 0, 0), 2); 
+    GFX_DrawString(temp_text, TEMP_X, TEMP_Y, RGB565(255, 255, 0), RGB565(0, 0, 0), TEMP_SCALE);
 
     // 스케일 3 (15x15 폰트처럼 보임)
-    ili9341_draw_string_custom("Humid: 60.2 %", 10, 70, RGB565(0, 255, 255), RGB565(0, 0, 0), 3); 
+    GFX_DrawString("Humid: 60.2 %", 10, 70, RGB565(0, 255, 255), RGB565(0, 0, 0), 3); 
 
     // 스케일 4 (20x20 폰트처럼 보임)
-    ili9341_draw_string_custom("Test", 10, 130, RGB565(255, 0, 255), RGB565(0, 0, 0), 4);
+    GFX_DrawString("Test", 10, 130, RGB565(255, 0, 255), RGB565(0, 0, 0), 4);
+
+    // RGB565 uint16_t 버퍼는 16비트 SPI 프레임으로 바로 전송
+    GFX_DrawImage16(10, 160, SMALL_IMAGE_WIDTH, SMALL_IMAGE_HEIGHT, small_test_image);
+
+    // 비동기 명령 큐: 막대 그래프 한 프레임을 큐에 넣고 바로 다음 작업으로 넘어감
+    for (uint16_t i = 0; i < 8; i++) {
+        LCD_Queue_FillRect(10 + i * 20, 280 - i * 8, 16, 20 + i * 8, RGB565(0, 200, 255), 0, 0);
+    }
+    LCD_Queue_Marker(lcd_frame_done, 0);
+    UART2_transmit_string("Bar frame queued.\r\n");   // DMA가 막대를 그리는 동안 UART 출력
+    LCD_Queue_Flush();
+    // 그래프 축과 추세선 (run 단위로 창을 잡는 선 프리미티브)
+    GFX_DrawHLine(8, 301, 164, COLOR_WHITE);
+    GFX_DrawVLine(8, 200, 102, COLOR_WHITE);
+    GFX_DrawLine(18, 280, 158, 224, COLOR_YELLOW);
+
+    // 원형 게이지: 겹치는 도형(고리, 원호, 바늘, 중심 원)을 RAM 띠에 합성해서 한 번에 전송
+    {
+        uint32_t t0 = ms_uptime;
+        uint16_t bands = Strip_Render(GAUGE_X, GAUGE_Y, GAUGE_SIZE, GAUGE_SIZE, COLOR_BLACK, gauge_draw, &gauge_deg);
+        UART2_transmit_string("Gauge strip frame: ");
+        UART2_transmit_int(ms_uptime - t0);
+        UART2_transmit_string(" ms, bands: ");
+        UART2_transmit_int(bands);
+        UART2_transmit_string("\r\n");
+    }
+    // 반투명 그림자: 이미 그린 막대 그래프 위를 GRAM에서 읽어 블렌딩 (배경을 몰라도 됨)
+    GFX_BlendRect(10, 250, 80, 30, COLOR_BLACK, 128);
+    {
+        lcd_queue_stats_t qs;
+        LCD_Queue_GetStats(&qs);
+        UART2_transmit_string("LCD queue high water: ");
+        UART2_transmit_int(qs.high_water);
+        UART2_transmit_string(", stalls: ");
+        UART2_transmit_int(qs.stalls);
+        UART2_transmit_string(", frames: ");
+        UART2_transmit_int(lcd_frames_done);
+        UART2_transmit_string("\r\n");
+    }
+
+    // 송신 전용 모드로 피한 SPI RX 인터럽트 횟수 출력
+    ILI9341_WaitDone();
+    UART2_transmit_string("SPI1 RX ISR avoided: ");
+    UART2_transmit_int(spi1_rx_irq_avoided);
+    UART2_transmit_string("\r\n");
+    UART2_transmit_string("Address window bytes skipped: ");
+    UART2_transmit_int(ILI9341_GetSkippedSetupBytes());
+    UART2_transmit_string("\r\n");
+
+    blend_benchmark();
+
+    Dirty_Init(GFX_GetWidth(), GFX_GetHeight());
+    uint16_t temp_x10 = 255;
+    uint32_t next_update_ms = ms_uptime;
+    uint32_t temp_frames = 0;
 
     while(true) // 무한 루프
 	{
-
+        // 0.5초마다 온도 값을 바꾸고 바뀐 글자만 다시 그림
+        if ((int32_t)(ms_uptime - next_update_ms) >= 0) {
+            dirty_rect_t rects[DIRTY_MAX_RECTS];
+            uint8_t n, i;
+
+            next_update_ms += 500;
+            temp_x10 = (temp_x10 >= 305) ? 255 : temp_x10 + 3;
+            temp_update(temp_x10);
+            // 바늘 각도: 25.5 ~ 30.5도 -> 눈금 전체. 덧그리기 없이 띠 단위로 다시 합성하므로 깜빡이지 않음
+            gauge_deg = GAUGE_START + (int16_t)((temp_x10 - 255) * GAUGE_SPAN / 50);
+            if (gauge_deg > GAUGE_START + GAUGE_SPAN) gauge_deg = GAUGE_START + GAUGE_SPAN; // 30.6도 등 눈금 끝을 넘는 값은 끝에 고정
+            Strip_Render(GAUGE_X, GAUGE_Y, GAUGE_SIZE, GAUGE_SIZE, COLOR_BLACK, gauge_draw, &gauge_deg);
+
+            n = Dirty_Take(rects);
+            for (i = 0; i < n; i++) {
+                GFX_PushClip(rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+                scene_redraw();
+                GFX_PopClip();
+            }
+            if (++temp_frames % 20 == 0) dirty_report();   // 10초마다 절약량 출력
+        }
 	}
 }
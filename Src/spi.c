@@ -7,9 +7,12 @@
 
 #include "spi.h"
 
+volatile uint32_t spi1_rx_irq_count = 0;    // SPI1 RX 인터럽트가 실제로 발생한 횟수
+volatile uint32_t spi1_rx_irq_avoided = 0;  // RX 인터럽트를 꺼 둔 상태로 보낸 프레임 수 (= 피한 ISR 진입 횟수)
+
 /**
   * @brief  SPI1 마스터 모드 초기화 함수
-  *         GPIO 핀 설정, SPI 주변장치 설정, RXNE 인터럽트 활성화 및 NVIC 설정.
+  *         GPIO 핀 설정, SPI 주변장치 설정, NVIC 설정 (RXNEIE는 끈 채로 두고 읽기는 폴링으로 처리).
   * @retval 없음
   */
 void SPI1_init(void) {
@@ -27,18 +30,19 @@ void SPI1_init(void) {
     // 3. SPI1 주변장치 초기화 (CR1, CR2 레지스터)
     // - Mode 0 (CPOL=0, CPHA=0)으로 설정: 클럭 유휴 상태는 LOW, 첫 번째 클럭 엣지에서 데이터 샘플링
     // - 마스터 모드 (MSTR 비트 설정)
-    // - 보드레이트 프리스케일러: PCLK2 / 4 (PCLK2=64MHz -> SPI 클럭 16MHz)
+    // - 보드레이트 프리스케일러: PCLK2 / 4 (PCLK2=64MHz -> SPI 클럭 16MHz), SPI1_BAUDRATE_PRESCALER로 변경 가능
     // - 소프트웨어 슬레이브 관리 (SSM, SSI 비트 설정): CS 핀을 소프트웨어로 제어
     SPI1->CR1 |= ( (0 << SPI_CR1_CPOL_Pos) |        // CPOL=0
                    (0 << SPI_CR1_CPHA_Pos) |        // CPHA=0 (ILI9341 데이터시트에 따라)
                    (1 << SPI_CR1_MSTR_Pos) |        // 마스터 모드
-                   (1 << SPI_CR1_BR_Pos)   |        // 보드레이트 프리스케일러: PCLK2 / 4 (0b001)
+                   (SPI1_BAUDRATE_PRESCALER << SPI_CR1_BR_Pos) | // 보드레이트 프리스케일러 (기본 PCLK2 / 4, spi.h 참조)
                    (1 << SPI_CR1_SSM_Pos)  |        // 소프트웨어 슬레이브 관리 활성화
                    (1 << SPI_CR1_SSI_Pos) );        // 내부 슬레이브 셀렉트 (마스터 모드에서 SSM 사용 시)
 
-    // CR2 레지스터: RXNE (Receive buffer Not Empty) 인터럽트 활성화
-    // LCD 제어에는 송신만 주로 하지만, ID를 읽거나 하는 경우를 위해 활성화 (디버깅에도 도움)
-    SPI1->CR2 |= SPI_CR2_RXNEIE;
+    // CR2 레지스터: RXNE (Receive buffer Not Empty) 인터럽트는 기본적으로 끈다 (송신 전용).
+    // LCD 픽셀 전송 중에는 바이트마다 ISR이 불려 수신 데이터를 버리기만 하므로 켜지 않는다.
+    // ID/GRAM 읽기도 SPI1_read()가 RXNE를 폴링하므로 RXNEIE는 항상 0으로 유지한다.
+    SPI1->CR2 &= ~SPI_CR2_RXNEIE;
 
     // 4. SPI 주변장치 활성화 (SPE 비트 설정)
     SPI1->CR1 |= SPI_CR1_SPE;
@@ -46,6 +50,9 @@ void SPI1_init(void) {
     // 5. NVIC (Nested Vectored Interrupt Controller) 설정
     NVIC_SetPriority(SPI1_IRQn, 0);     // SPI1 인터럽트 우선순위 설정 (0이 가장 높은 우선순위)
     NVIC_EnableIRQ(SPI1_IRQn);          // SPI1 인터럽트 활성화
+
+    // 6. SPI1_TX DMA 채널 (DMA1 Channel 3) 준비
+    SPI1_DMA_init();
 }
 
 /**
@@ -59,6 +66,7 @@ uint8_t SPI1_transfer(uint8_t data) {
 
     // 2. DR(데이터 레지스터)에 데이터를 씀으로써 전송 시작
     SPI1->DR = data;
+    spi1_rx_irq_avoided++;
 
     // 3. RX 버퍼에 데이터가 들어올 때까지 대기 (데이터 수신 완료)
     // while (!(SPI1->SR & SPI_SR_RXNE));
@@ -67,6 +75,119 @@ uint8_t SPI1_transfer(uint8_t data) {
     // return (uint8_t)SPI1->DR;
 }
 
+/**
+  * @brief  SPI 전송이 완전히 끝날 때까지 대기 (TXE=1 이후 BSY=0)
+  *         TXE만 보면 마지막 바이트가 아직 시프트 중일 수 있으므로,
+  *         CS/DC를 바꾸거나 DFF를 바꾸기 전에는 반드시 이 함수로 기다린다.
+  */
+void SPI1_wait_idle(void) {
+    while (!(SPI1->SR & SPI_SR_TXE));
+    while (SPI1->SR & SPI_SR_BSY);
+}
+
+/**
+  * @brief  바이트 배열을 연속으로 전송하고 마지막에 한 번만 BSY를 기다림 (버스트 쓰기)
+  *         TXE가 서는 즉시 다음 바이트를 넣어 SCK가 끊기지 않게 하며,
+  *         함수가 돌아오면 마지막 비트까지 나간 상태이므로 바로 CS/DC를 바꿔도 안전하다.
+  * @param  data: 전송할 데이터 배열
+  * @param  len: 전송할 바이트 수
+  */
+void SPI1_write(const uint8_t *data, uint32_t len) {
+    spi1_rx_irq_avoided += len;
+    while (len--) {
+        while (!(SPI1->SR & SPI_SR_TXE));
+        SPI1->DR = *data++;
+    }
+    SPI1_wait_idle();
+}
+
+/**
+  * @brief  SPI1을 16비트 프레임 모드로 전환 (CR1 DFF=1)
+  *         RGB565 픽셀 스트림(RAMWR 데이터)용. 앞선 전송이 끝난 뒤 SPE를 잠시 끄고 바꾼다.
+  */
+void SPI1_set_16bit_mode(void) {
+    SPI1_wait_idle();
+    SPI1->CR1 &= ~SPI_CR1_SPE;
+    SPI1->CR1 |= SPI_CR1_DFF;
+    SPI1->CR1 |= SPI_CR1_SPE;
+}
+
+/**
+  * @brief  SPI1을 8비트 프레임 모드로 복귀 (CR1 DFF=0)
+  *         명령/파라미터 바이트 전송용 기본 모드.
+  */
+void SPI1_set_8bit_mode(void) {
+    SPI1_wait_idle();
+    SPI1->CR1 &= ~SPI_CR1_SPE;
+    SPI1->CR1 &= ~SPI_CR1_DFF;
+    SPI1->CR1 |= SPI_CR1_SPE;
+}
+
+/**
+  * @brief  SPI1로 16비트 프레임 하나를 전송 (블로킹, 16비트 모드에서만 사용)
+  * @param  data: 전송할 16비트 데이터 (RGB565 픽셀, MSB 먼저 전송됨)
+  */
+void SPI1_transfer16(uint16_t data) {
+    while (!(SPI1->SR & SPI_SR_TXE));
+    SPI1->DR = data;
+    spi1_rx_irq_avoided++;
+}
+
+/**
+  * @brief  uint16_t 버퍼를 16비트 프레임으로 연속 전송 (블로킹, 16비트 모드에서만 사용)
+  * @param  data: 전송할 데이터 배열
+  * @param  count: 전송할 프레임 수
+  */
+void SPI1_write16(const uint16_t *data, uint32_t count) {
+    spi1_rx_irq_avoided += count;
+    while (count--) {
+        while (!(SPI1->SR & SPI_SR_TXE));
+        SPI1->DR = *data++;
+    }
+}
+
+/**
+  * @brief  수신 버퍼에 남아 있는 데이터와 OVR 플래그를 비움
+  *         송신 전용으로 보내는 동안 DR을 읽지 않으므로 RXNE/OVR이 남아 있다.
+  */
+void SPI1_rx_flush(void) {
+    volatile uint32_t dummy;
+    SPI1_wait_idle();
+    dummy = SPI1->DR;   // RXNE 클리어
+    dummy = SPI1->SR;   // DR -> SR 순서로 읽어 OVR 클리어
+    (void)dummy;
+}
+
+/**
+  * @brief  SPI1 보드레이트 프리스케일러 변경 (CR1 BR[2:0])
+  *         LCD 읽기(RAMRD)처럼 느린 클럭이 필요한 구간에서 사용. SPE를 잠시 끄고 바꾼다.
+  * @param  prescaler: 0 = PCLK2/2, 1 = PCLK2/4, ... 7 = PCLK2/256
+  */
+void SPI1_set_baudrate(uint8_t prescaler) {
+    SPI1_wait_idle();
+    SPI1->CR1 &= ~SPI_CR1_SPE;
+    SPI1->CR1 = (SPI1->CR1 & ~SPI_CR1_BR) | (((uint32_t)prescaler << SPI_CR1_BR_Pos) & SPI_CR1_BR);
+    SPI1->CR1 |= SPI_CR1_SPE;
+}
+
+/**
+  * @brief  SPI1로 len 바이트를 읽음 (블로킹, 폴링 방식, 8비트 모드)
+  *         바이트마다 더미 0xFF를 보내 클럭을 만들고 MISO로 들어온 값을 읽는다.
+  *         RXNEIE는 항상 0이므로 ISR이 수신 데이터를 먼저 가져가지 않는다.
+  * @param  data: 수신 데이터를 저장할 버퍼
+  * @param  len: 읽을 바이트 수
+  */
+void SPI1_read(uint8_t *data, uint32_t len) {
+    SPI1_rx_flush();    // 송신 중 쌓인 RXNE/OVR 제거
+    while (len--) {
+        while (!(SPI1->SR & SPI_SR_TXE));
+        SPI1->DR = 0xFF;
+        while (!(SPI1->SR & SPI_SR_RXNE));
+        *data++ = (uint8_t)SPI1->DR;
+    }
+    while (SPI1->SR & SPI_SR_BSY);
+}
+
 /**
   * @brief  SPI1 글로벌 인터럽트 핸들러 (ISR)
   *         startup_stm32f103xb.s 파일의 벡터 테이블에 정의된 `SPI1_IRQHandler` 이름과 일치해야 함.
@@ -76,6 +197,8 @@ void SPI1_IRQHandler(void) {
     if (SPI1->SR & SPI_SR_RXNE) {
         // DR에서 데이터를 읽으면 RXNE 플래그가 자동으로 클리어됨 (필수!)
         volatile uint8_t received_byte = (uint8_t)SPI1->DR;
+        (void)received_byte;
+        spi1_rx_irq_count++;
     }
     // OVR (Overrun error) 플래그가 설정되었는지 확인
     if (SPI1->SR & SPI_SR_OVR) {
@@ -85,5 +208,149 @@ void SPI1_IRQHandler(void) {
         (void)dummy_read_sr; (void)dummy_read_dr; // unused variable warning 방지
     }
 }
+
+// ====================================================================
+// ==== SPI1 TX DMA (DMA1 Channel 3) ==================================
+// ====================================================================
+// DMA는 한 번에 최대 65535개 프레임만 보낼 수 있으므로 큰 전송은 청크로 나눈다.
+#define SPI1_DMA_MAX_COUNT  65535U
+
+static volatile uint16_t spi1_dma_fill_value;     // 단색 채우기용 DMA 소스 (메모리 주소 고정)
+static const uint16_t * volatile spi1_dma_src;    // 다음 청크의 소스 주소
+static volatile uint8_t  spi1_dma_minc = 0;       // 1: 메모리 주소 증가 (버퍼 전송), 0: 고정 (단색 채우기)
+static volatile uint8_t  spi1_dma_restore_8bit = 0; // 1: 완료 후 8비트 모드로 복귀
+static volatile uint32_t spi1_dma_remaining = 0;  // 아직 DMA에 넘기지 않은 프레임 수
+static volatile uint8_t  spi1_dma_busy = 0;       // 1: DMA 전송 진행 중
+static void (* volatile spi1_dma_done_cb)(void) = 0; // 전송 완료 콜백 (ISR 문맥에서 호출)
+
+/**
+  * @brief  다음 DMA 청크 시작 (최대 SPI1_DMA_MAX_COUNT 프레임)
+  */
+static void SPI1_DMA_start_chunk(void) {
+    uint32_t count = spi1_dma_remaining;
+    if (count > SPI1_DMA_MAX_COUNT) count = SPI1_DMA_MAX_COUNT;
+    spi1_dma_remaining -= count;
+
+    DMA1_Channel3->CCR &= ~DMA_CCR_EN;           // 채널을 꺼야 CNDTR/CMAR를 쓸 수 있음
+    DMA1_Channel3->CNDTR = count;
+    DMA1_Channel3->CMAR  = (uint32_t)spi1_dma_src;
+    // 메모리 -> 주변장치, 16비트/16비트, 완료/에러 인터럽트
+    // MINC=0이면 같은 색상 값을 반복 전송, MINC=1이면 버퍼를 순서대로 전송
+    DMA1_Channel3->CCR = DMA_CCR_DIR | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 |
+                         DMA_CCR_PL_1 | DMA_CCR_TCIE | DMA_CCR_TEIE |
+                         (spi1_dma_minc ? DMA_CCR_MINC : 0);
+    if (spi1_dma_minc) spi1_dma_src += count;
+    DMA1_Channel3->CCR |= DMA_CCR_EN;
+}
+
+/**
+  * @brief  DMA 전송 시작 공통 처리
+  *         SPI1이 8비트 모드였다면 16비트로 바꾸고 완료 후 되돌리며,
+  *         이미 16비트 모드(픽셀 스트림 중)라면 모드를 그대로 둔다.
+  */
+static void SPI1_DMA_start(const uint16_t *src, uint8_t minc, uint32_t count, void (*done)(void)) {
+    spi1_dma_restore_8bit = !(SPI1->CR1 & SPI_CR1_DFF);
+    if (spi1_dma_restore_8bit) {
+        SPI1_set_16bit_mode();       // 앞선 바이트가 모두 나간 뒤에 DFF 변경
+    }
+
+    spi1_dma_src        = src;
+    spi1_dma_minc       = minc;
+    spi1_dma_remaining  = count;
+    spi1_dma_done_cb    = done;
+    spi1_dma_busy       = 1;
+    spi1_rx_irq_avoided += count;
+
+    SPI1->CR2 |= SPI_CR2_TXDMAEN;    // TXE 발생 시 DMA 요청
+    SPI1_DMA_start_chunk();
+}
+
+/**
+  * @brief  SPI1_TX용 DMA1 Channel 3 초기화 (SPI1_init에서 호출)
+  */
+void SPI1_DMA_init(void) {
+    RCC->AHBENR |= RCC_AHBENR_DMA1EN;            // DMA1 클럭 활성화
+    DMA1_Channel3->CCR  = 0;
+    DMA1_Channel3->CPAR = (uint32_t)&SPI1->DR;   // 목적지: SPI1 데이터 레지스터
+
+    NVIC_SetPriority(DMA1_Channel3_IRQn, 1);
+    NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+}
+
+/**
+  * @brief  같은 16비트 값을 count번 DMA로 전송 (비블로킹)
+  *         전송 동안 SPI1은 16비트 프레임 모드로 동작하고, 완료 후 원래 모드로 돌아온다.
+  *         CS/DC는 호출자가 미리 설정해야 하며, done 콜백에서 CS를 해제하면 된다.
+  * @param  value: 반복 전송할 값 (RGB565 색상 등)
+  * @param  count: 전송할 프레임 수 (65535를 넘으면 자동으로 나눠 전송)
+  * @param  done: 전송 완료 시 ISR에서 호출할 콜백 (NULL 가능)
+  */
+void SPI1_DMA_fill16(uint16_t value, uint32_t count, void (*done)(void)) {
+    SPI1_DMA_wait();                 // 이전 DMA 전송이 끝날 때까지 대기
+    if (count == 0) {
+        if (done) done();
+        return;
+    }
+    spi1_dma_fill_value = value;
+    SPI1_DMA_start((const uint16_t *)&spi1_dma_fill_value, 0, count, done);
+}
+
+/**
+  * @brief  uint16_t 버퍼를 DMA로 전송 (비블로킹)
+  *         버퍼는 전송이 끝날 때까지(완료 콜백 또는 SPI1_DMA_busy() == 0) 유지되어야 한다.
+  * @param  data: 전송할 버퍼 (RGB565 픽셀 등)
+  * @param  count: 전송할 프레임 수
+  * @param  done: 전송 완료 시 ISR에서 호출할 콜백 (NULL 가능)
+  */
+void SPI1_DMA_write16(const uint16_t *data, uint32_t count, void (*done)(void)) {
+    SPI1_DMA_wait();                 // 이전 DMA 전송이 끝날 때까지 대기
+    if (count == 0) {
+        if (done) done();
+        return;
+    }
+    SPI1_DMA_start(data, 1, count, done);
+}
+
+/**
+  * @brief  DMA 전송이 진행 중인지 확인 (완료 플래그)
+  * @retval 1: 전송 중, 0: 유휴
+  */
+uint8_t SPI1_DMA_busy(void) {
+    return spi1_dma_busy;
+}
+
+/**
+  * @brief  진행 중인 DMA 전송이 끝날 때까지 대기
+  */
+void SPI1_DMA_wait(void) {
+    while (spi1_dma_busy);
+}
+
+/**
+  * @brief  DMA1 Channel 3 인터럽트 핸들러 (SPI1_TX)
+  *         남은 프레임이 있으면 다음 청크를 시작하고, 없으면 SPI 모드를 되돌린 뒤 콜백 호출.
+  */
+void DMA1_Channel3_IRQHandler(void) {
+    uint32_t isr = DMA1->ISR;
+    DMA1->IFCR = DMA_IFCR_CGIF3;     // 채널 3의 모든 플래그 클리어
+
+    if ((isr & DMA_ISR_TCIF3) && !(isr & DMA_ISR_TEIF3) && spi1_dma_remaining) {
+        SPI1_DMA_start_chunk();
+        return;
+    }
+
+    DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+    SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
+    spi1_dma_remaining = 0;
+
+    if (spi1_dma_restore_8bit) {
+        SPI1_set_8bit_mode();        // 마지막 프레임이 완전히 나간 뒤에 DFF 복귀
+    } else if (spi1_dma_done_cb) {
+        SPI1_wait_idle();            // 콜백이 CS를 바꿀 수 있으므로 마지막 프레임까지 대기
+    }
+
+    spi1_dma_busy = 0;
+    if (spi1_dma_done_cb) spi1_dma_done_cb();
+}
 // ====================================================================
 // ==== /SPI 드라이버 통합 끝 =========================================
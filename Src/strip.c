@@ -0,0 +1,209 @@
+/*
+ * strip.c
+ *
+ *  Created on: 2026. 1. 18.
+ *      Author: minseopkim
+ */
+
+#include "strip.h"
+#include "gfx.h"
+
+static uint16_t strip_buf[STRIP_BUFFER_PIXELS];       // 핑퐁 띠 버퍼 (앞/뒤 절반)
+static uint16_t strip_linebuf[STRIP_LINEBUF_PIXELS];  // stream_buffer()용 임시 줄 버퍼
+
+static const display_driver_t *strip_panel;  // 렌더링 중 원래 패널 드라이버
+static uint16_t *strip_band;                  // 현재 띠 버퍼
+static int16_t strip_x0, strip_y0;           // 현재 띠 왼쪽 위의 화면 좌표
+static uint16_t strip_w, strip_rows;          // 현재 띠 크기
+
+// 스트림 창과 쓰기 위치 (화면 좌표)
+static uint16_t strip_wx1, strip_wx2, strip_wy2;
+static uint16_t strip_cx, strip_cy;
+
+// ====================================================================
+// ==== RAM 띠 드라이버 (display_driver_t) ============================
+// ====================================================================
+// GFX가 클립 영역을 현재 띠로 잘라서 넘기므로 좌표는 항상 띠 안이지만, 방어적으로 한 번 더 확인한다.
+
+static void Strip_Init(void) {
+}
+
+static uint16_t Strip_Width(void) {
+    return strip_panel->width();
+}
+
+static uint16_t Strip_Height(void) {
+    return strip_panel->height();
+}
+
+static void Strip_SetRotation(uint8_t rotation) {
+    (void)rotation;   // 렌더링 중에는 회전하지 않음
+}
+
+static void Strip_FillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+    int32_t x0 = x - strip_x0, y0 = y - strip_y0;
+    int32_t x1 = x0 + w, y1 = y0 + h;
+    int32_t row, i;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > strip_w) x1 = strip_w;
+    if (y1 > strip_rows) y1 = strip_rows;
+
+    for (row = y0; row < y1; row++) {
+        uint16_t *p = strip_band + (uint32_t)row * strip_w;
+        for (i = x0; i < x1; i++) p[i] = color;
+    }
+}
+
+static void Strip_StreamBegin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    strip_wx1 = x1;
+    strip_wx2 = x2;
+    strip_wy2 = y2;
+    strip_cx = x1;
+    strip_cy = y1;
+}
+
+static uint16_t *Strip_StreamBuffer(void) {
+    return strip_linebuf;
+}
+
+/**
+  * @brief  창 쓰기 위치부터 픽셀을 띠 버퍼에 복사 (패널 GRAM과 같은 순서로 행 단위 줄 바꿈)
+  */
+static void Strip_Put(const uint16_t *pixels, uint32_t count) {
+    while (count && strip_cy <= strip_wy2) {
+        uint32_t n = strip_wx2 - strip_cx + 1;   // 현재 행에 남은 픽셀 수
+        int32_t row = strip_cy - strip_y0;
+        int32_t col = strip_cx - strip_x0;
+        uint32_t i;
+
+        if (n > count) n = count;
+        if (row >= 0 && row < strip_rows) {
+            uint16_t *p = strip_band + (uint32_t)row * strip_w;
+            for (i = 0; i < n; i++, col++) {
+                if (col >= 0 && col < strip_w) p[col] = pixels[i];
+            }
+        }
+        pixels += n;
+        count -= n;
+        strip_cx += n;
+        if (strip_cx > strip_wx2) {
+            strip_cx = strip_wx1;
+            strip_cy++;
+        }
+    }
+}
+
+static void Strip_StreamSubmit(uint16_t count) {
+    Strip_Put(strip_linebuf, count);
+}
+
+static void Strip_StreamWrite(const uint16_t *pixels, uint32_t count) {
+    Strip_Put(pixels, count);
+}
+
+static void Strip_StreamEnd(void) {
+}
+
+/**
+  * @brief  띠 버퍼에서 읽기 (GFX_BlendRect가 이미 합성된 내용 위에 블렌딩할 수 있도록). 띠 밖은 0
+  */
+static void Strip_ReadPixels(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *buf) {
+    uint16_t i, j;
+
+    for (j = 0; j < h; j++) {
+        int32_t row = y + j - strip_y0;
+        for (i = 0; i < w; i++) {
+            int32_t col = x + i - strip_x0;
+            *buf++ = (row >= 0 && row < strip_rows && col >= 0 && col < strip_w)
+                     ? strip_band[(uint32_t)row * strip_w + col] : 0;
+        }
+    }
+}
+
+static void Strip_SetScrollArea(uint16_t top_fixed, uint16_t bottom_fixed) {
+    (void)top_fixed;
+    (void)bottom_fixed;
+}
+
+static void Strip_ScrollTo(uint16_t offset) {
+    (void)offset;
+}
+
+static void Strip_WaitIdle(void) {
+}
+
+static const display_driver_t strip_driver = {
+    .name            = "strip",
+    .linebuf_pixels  = STRIP_LINEBUF_PIXELS,
+    .init            = Strip_Init,
+    .width           = Strip_Width,
+    .height          = Strip_Height,
+    .set_rotation    = Strip_SetRotation,
+    .fill_rect       = Strip_FillRect,
+    .stream_begin    = Strip_StreamBegin,
+    .stream_buffer   = Strip_StreamBuffer,
+    .stream_submit   = Strip_StreamSubmit,
+    .stream_write    = Strip_StreamWrite,
+    .stream_end      = Strip_StreamEnd,
+    .read_pixels     = Strip_ReadPixels,
+    .set_scroll_area = Strip_SetScrollArea,
+    .scroll_to       = Strip_ScrollTo,
+    .wait_idle       = Strip_WaitIdle,
+};
+
+// ====================================================================
+// ==== 띠 단위 렌더링 ================================================
+// ====================================================================
+/**
+  * @brief  영역을 띠 단위로 합성해서 패널에 전송 (깜빡임 없는 프레임)
+  *         띠마다 bg로 지우고 draw를 호출한 뒤, 패널 창 하나에 띠를 이어서 DMA로 보낸다.
+  *         띠마다 호출자의 현재 클립 영역과 띠를 교차한 클립을 쌓았다가 되돌리므로, 클립 스택은 호출 전 상태로 남는다.
+  *         좌표는 화면 기준이므로 뷰포트(원점 이동) 없이 호출할 것. 스택이 가득 차 있으면 띠 클립 없이 그린다.
+  * @param  x, y, w, h: 다시 그릴 화면 영역 (화면 밖은 잘라냄, 변경 영역 창을 그대로 넘겨도 됨)
+  * @param  bg: 배경색 (16비트 RGB565)
+  * @param  draw: 장면 그리기 콜백 (화면 좌표, 띠마다 호출)
+  * @param  arg: 콜백 인자
+  * @retval 그린 띠 수 (0이면 그릴 영역 없음)
+  */
+uint16_t Strip_Render(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg, strip_draw_t draw, void *arg) {
+    const display_driver_t *panel = GFX_GetDriver();
+    int32_t x1 = x + w, y1 = y + h;
+    uint16_t half = STRIP_BUFFER_PIXELS / 2;
+    uint16_t rows, bands = 0;
+    int32_t band_y;
+    uint32_t i;
+    uint8_t pushed;
+
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 > panel->width()) x1 = panel->width();
+    if (y1 > panel->height()) y1 = panel->height();
+    if (x >= x1 || y >= y1) return 0;
+    rows = half / (x1 - x);       // 띠 하나의 줄 수
+    if (rows == 0) return 0;
+
+    strip_panel = panel;
+    strip_x0 = x;
+    strip_w = x1 - x;
+
+    panel->stream_begin(x, y, x1 - 1, y1 - 1);
+    GFX_SetDriver(&strip_driver);
+    for (band_y = y; band_y < y1; band_y += rows, bands++) {
+        // 같은 절반 버퍼를 쓰던 두 띠 전 전송은 직전 띠의 stream_write가 시작될 때 이미 끝나 있다
+        strip_band = strip_buf + (bands & 1) * half;
+        strip_y0 = band_y;
+        strip_rows = (y1 - band_y < rows) ? (uint16_t)(y1 - band_y) : rows;
+        for (i = 0; i < (uint32_t)strip_w * strip_rows; i++) strip_band[i] = bg;
+
+        pushed = GFX_PushClip(strip_x0, strip_y0, strip_w, strip_rows); // 호출자 클립과 교차
+        draw(arg);
+        if (pushed) GFX_PopClip(); // 실패했으면 호출자의 클립을 꺼내지 않음 (띠 밖 픽셀은 띠 드라이버가 버림)
+
+        panel->stream_write(strip_band, (uint32_t)strip_w * strip_rows);
+    }
+    GFX_SetDriver(panel);
+    panel->stream_end();
+    return bands;
+}